@@ -43,6 +43,16 @@ struct Config {
 #endif
     U64 stagingBufferSize = 64*1024*1024;
     bool headless = false;
+
+    // CPU threads. Core indices are zero-based, negative values leave the
+    // thread unpinned. A real-time priority of zero keeps the default
+    // scheduler, otherwise the thread is moved to SCHED_FIFO (1-99).
+    U64 workerThreads = 0;
+    I64 computeCore = -1;
+    I64 renderCore = -1;
+    I64 sourceCore = -1;
+    U64 realtimePriority = 0;
+    bool lockMemory = false;
 };
 
 }  // namespace Jetstream::Backend
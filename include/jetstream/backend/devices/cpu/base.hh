@@ -1,15 +1,137 @@
 #ifndef JETSTREAM_BACKEND_DEVICE_CPU_HH
 #define JETSTREAM_BACKEND_DEVICE_CPU_HH
 
+#include <mutex>
+#include <deque>
+#include <string>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
 #include "jetstream/backend/config.hh"
 
 namespace Jetstream::Backend {
 
 class CPU {
  public:
+    enum class ThreadRole : U8 {
+        Compute = 0,
+        Render  = 1,
+        Source  = 2,
+        Worker  = 3,
+    };
+
+    // Processor features detected once at startup. Available without an
+    // initialized backend, benchmarks and kernels query it directly.
+    struct Capabilities {
+        std::string processorName = "Unknown";
+        std::string architecture = "Unknown";
+
+        U64 physicalCores = 0;
+        U64 logicalCores = 0;
+
+        U64 l1DataCacheSize = 0;
+        U64 l2CacheSize = 0;
+        U64 l3CacheSize = 0;
+        U64 cacheLineSize = 64;
+
+        bool sse42 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+        bool neon = false;
+        bool sve = false;
+
+        // Logical processors of each NUMA node. Empty when unknown.
+        std::vector<std::vector<U64>> numaNodes;
+
+        std::string isa() const;
+    };
+
+    static const Capabilities& GetCapabilities();
+
+    // Edge of the largest square tile of elements that fits in half of the
+    // L1 data cache. Leaves room for the destination of blocked kernels.
+    static U64 GetTileSize(const U64& elementSize);
+
+    // NUMA placement. A node of -1 means no preference, memory is left to
+    // the first-touch policy of the operating system. Binding is a no-op on
+    // single node machines and platforms without NUMA support.
+    static U64 GetNumaNodeCount();
+    static I64 GetNumaNodeOfCore(const I64& core);
+    static I64 GetCurrentNumaNode();
+    static Result BindMemory(void* ptr, const U64& size, const I64& node);
+    static Result BindThreadToNumaNode(const I64& node);
+
+    // Node used by CPU allocations of the calling thread. Defaults to the
+    // node of the pinned compute thread, the consumer of most buffers.
+    static I64 GetAllocationNode();
+
+    // Overrides the allocation node of the calling thread within a scope.
+    class NumaScope {
+     public:
+        explicit NumaScope(const I64& node);
+        ~NumaScope();
+
+        NumaScope(const NumaScope&) = delete;
+        NumaScope& operator=(const NumaScope&) = delete;
+
+     private:
+        I64 previous;
+        bool previousSet;
+    };
+
     explicit CPU(const Config& config);
+    ~CPU();
+
+    // Applies the core affinity and scheduling policy of the role to the
+    // calling thread. Cheap enough to be called every loop iteration, the
+    // policy is only applied again after the configuration changes.
+    Result applyThreadPolicy(const ThreadRole& role);
+
+    // Replaces the thread settings. The worker pool is resized and long
+    // running threads pick the new policy on their next call above.
+    Result reconfigure(const Config& config);
+
+    // Shared worker pool. Workers are spread across the NUMA nodes, a task
+    // with a node runs on a worker of that node. Workers are started by the
+    // first submitted task, so processes that never use the pool don't pay
+    // for idle threads.
+    std::future<void> submit(std::function<void()> task, const I64& node = -1);
+    Result parallelFor(const U64& count, const std::function<void(const U64&)>& task);
+
+    U64 getWorkerCount() const;
+    U64 getTotalProcessorCount() const;
+
+    Config getConfig() const;
+
+ private:
+    Config config;
+
+    mutable std::mutex configMutex;
+    std::atomic<U64> policyGeneration{1};
+    bool memoryLocked = false;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::deque<std::packaged_task<void()>> queue;
+    std::vector<std::deque<std::packaged_task<void()>>> nodeQueues;
+    std::vector<std::thread> workers;
+    std::atomic<U64> workerCount{0};
+    bool workersRunning = false;
+    bool reconfiguring = false;
+
+    U64 plannedWorkerCount() const;
+    Result startWorkers();
+    Result stopWorkers();
+    Result updateMemoryLock();
+    void updateAllocationNode();
 };
 
 }  // namespace Jetstream::Backend
 
-#endif
+#endif
\ No newline at end of file
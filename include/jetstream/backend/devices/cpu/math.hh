@@ -0,0 +1,255 @@
+#ifndef JETSTREAM_BACKEND_DEVICE_CPU_MATH_HH
+#define JETSTREAM_BACKEND_DEVICE_CPU_MATH_HH
+
+#include <bit>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream::Backend {
+
+// Transcendental kernels with selectable accuracy. The approximations are
+// branch-free so the array kernels vectorize. Maximum errors were measured
+// against double precision (see tests/math.cc).
+//
+//  Function | Range           | Fast          | Balanced      | Exact
+//  ---------|-----------------|---------------|---------------|-------
+//  Log10    | [1e-6, 1e6]     | 4.1e-4 abs    | 8.3e-7 abs    | libm
+//  Atan2    | any             | 5.0e-3 rad    | 2.0e-6 rad    | libm
+//  Exp      | [-80, 80]       | 8.0e-4 rel    | 2.6e-7 rel    | libm
+//  SinCos   | [-1000, 1000]   | 3.3e-4 abs    | 1.2e-7 abs    | libm
+//
+// Log10 expects positive normal numbers. Exp saturates to the smallest and
+// largest normal numbers outside of [-87, 88].
+
+enum class MathAccuracy : U8 {
+    Fast     = 0,
+    Balanced = 1,
+    Exact    = 2,
+};
+
+inline Result StringToMathAccuracy(const std::string& string, MathAccuracy& accuracy) {
+    if (string == "fast") {
+        accuracy = MathAccuracy::Fast;
+    } else if (string == "balanced") {
+        accuracy = MathAccuracy::Balanced;
+    } else if (string == "exact") {
+        accuracy = MathAccuracy::Exact;
+    } else {
+        JST_ERROR("[MATH] Unknown accuracy '{}'. Expected 'fast', 'balanced' or 'exact'.", string);
+        return Result::ERROR;
+    }
+    return Result::SUCCESS;
+}
+
+//
+// Log10
+//
+
+template<MathAccuracy A>
+inline F32 Log10(const F32& x) {
+    if constexpr (A == MathAccuracy::Exact) {
+        return std::log10(x);
+    }
+
+    // Split into exponent and mantissa (x = m * 2^e).
+    const U32 bits = std::bit_cast<U32>(x);
+
+    if constexpr (A == MathAccuracy::Fast) {
+        // Cubic on m in [0.5, 1).
+        // Adapted from http://openaudio.blogspot.com/2017/02/faster-log10-and-pow.html
+        const F32 e = static_cast<F32>(static_cast<I32>(bits >> 23) - 127);
+        const F32 m = std::bit_cast<F32>((bits & 0x007FFFFF) | 0x3F000000);
+        F32 y = 1.23149591368684f;
+        y = y * m - 4.11852516267426f;
+        y = y * m + 6.02197014179219f;
+        y = y * m - 3.13396450166353f;
+        return (y + e + 1.0f) * 0.3010299956639812f;
+    } else {
+        // Center m in [sqrt(2)/2, sqrt(2)) and use the atanh series.
+        const I32 centered = static_cast<I32>(bits) - 0x3F3504F3;
+        const F32 e = static_cast<F32>(centered >> 23);
+        const F32 m = std::bit_cast<F32>(static_cast<U32>((centered & 0x007FFFFF) + 0x3F3504F3));
+
+        const F32 t = (m - 1.0f) / (m + 1.0f);
+        const F32 t2 = t * t;
+        F32 y = 2.0f / 9.0f;
+        y = y * t2 + 2.0f / 7.0f;
+        y = y * t2 + 2.0f / 5.0f;
+        y = y * t2 + 2.0f / 3.0f;
+        y = y * t2 + 2.0f;
+        return (y * t * 1.44269504089f + e) * 0.3010299956639812f;
+    }
+}
+
+//
+// Atan2
+//
+
+template<MathAccuracy A>
+inline F32 Atan2(const F32& y, const F32& x) {
+    if constexpr (A == MathAccuracy::Exact) {
+        return std::atan2(y, x);
+    }
+
+    // Fold into the first octant, z = min / max in [0, 1]. Magnitudes are
+    // compared and swapped as integers, selects on floats keep GCC from
+    // vectorizing the loop without -fno-trapping-math.
+    const U32 xbits = std::bit_cast<U32>(x) & 0x7FFFFFFF;
+    const U32 ybits = std::bit_cast<U32>(y) & 0x7FFFFFFF;
+    const U32 steep = (xbits - ybits) >> 31;
+    const U32 swap = (xbits ^ ybits) & (0u - steep);
+    const F32 hi = std::bit_cast<F32>(xbits ^ swap) + 1e-30f;
+    const F32 lo = std::bit_cast<F32>(ybits ^ swap);
+    const F32 z = lo / hi;
+    const F32 z2 = z * z;
+
+    F32 r;
+    if constexpr (A == MathAccuracy::Fast) {
+        // Adapted from https://www.dsprelated.com/showarticle/1052.php.
+        r = (0.97239411f - 0.19194795f * z2) * z;
+    } else {
+        // Minimax odd polynomial of degree 11.
+        r = -0.01172120f;
+        r = r * z2 + 0.05265332f;
+        r = r * z2 - 0.11643287f;
+        r = r * z2 + 0.19354346f;
+        r = r * z2 - 0.33262347f;
+        r = r * z2 + 0.99997726f;
+        r = r * z;
+    }
+
+    // Unfold octant and quadrant with sign flips for the same reason.
+    const U32 negative = std::bit_cast<U32>(x) >> 31;
+    r = std::bit_cast<F32>(std::bit_cast<U32>(r) ^ (static_cast<U32>(steep) << 31)) + static_cast<F32>(steep) * 1.57079632f;
+    r = std::bit_cast<F32>(std::bit_cast<U32>(r) ^ (negative << 31)) + static_cast<F32>(negative) * 3.14159265f;
+    return std::copysign(r, y);
+}
+
+//
+// Exp
+//
+
+template<MathAccuracy A>
+inline F32 Exp(const F32& x) {
+    if constexpr (A == MathAccuracy::Exact) {
+        return std::exp(x);
+    }
+
+    // Reduce to x = n * ln(2) + r with r in [-ln(2)/2, ln(2)/2].
+    const F32 n = std::nearbyint(x * 1.44269504089f);
+    F32 r = x - n * 0.693145752f;
+    r = r - n * 1.42860677e-6f;
+
+    // e^r Taylor series.
+    F32 p;
+    if constexpr (A == MathAccuracy::Fast) {
+        p = 1.6666667e-1f;
+        p = p * r + 0.5f;
+        p = p * r + 1.0f;
+        p = p * r + 1.0f;
+    } else {
+        p = 1.3888889e-3f;
+        p = p * r + 8.3333333e-3f;
+        p = p * r + 4.1666667e-2f;
+        p = p * r + 1.6666667e-1f;
+        p = p * r + 0.5f;
+        p = p * r + 1.0f;
+        p = p * r + 1.0f;
+    }
+
+    // Scale by 2^n through the exponent bits. Saturates to the smallest
+    // and largest normal numbers instead of wrapping the exponent.
+    const I32 exponent = std::min(std::max(static_cast<I32>(n) + 127, 1), 254);
+    return p * std::bit_cast<F32>(static_cast<U32>(exponent) << 23);
+}
+
+//
+// SinCos
+//
+
+template<MathAccuracy A>
+inline void SinCos(const F32& x, F32& sin, F32& cos) {
+    if constexpr (A == MathAccuracy::Exact) {
+        sin = std::sin(x);
+        cos = std::cos(x);
+        return;
+    }
+
+    // Reduce to r in [-pi/4, pi/4] and quadrant q.
+    const F32 k = std::nearbyint(x * 0.63661977236f);
+    const I32 q = static_cast<I32>(k);
+    F32 r = x - k * 1.5703125f;
+    r = r - k * 4.8382679e-4f;
+    const F32 r2 = r * r;
+
+    F32 s, c;
+    if constexpr (A == MathAccuracy::Fast) {
+        s = r * (1.0f + r2 * (-1.6666667e-1f + r2 * 8.3333333e-3f));
+        c = 1.0f + r2 * (-0.5f + r2 * 4.1666667e-2f);
+    } else {
+        s = 2.7557319e-6f;
+        s = s * r2 - 1.9841270e-4f;
+        s = s * r2 + 8.3333333e-3f;
+        s = s * r2 - 1.6666667e-1f;
+        s = s * r2 * r + r;
+
+        c = 2.4801587e-5f;
+        c = c * r2 - 1.3888889e-3f;
+        c = c * r2 + 4.1666667e-2f;
+        c = c * r2 - 0.5f;
+        c = c * r2 + 1.0f;
+    }
+
+    // Rotate by the quadrant.
+    const bool swap = (q & 1) != 0;
+    const F32 ss = swap ? c : s;
+    const F32 cc = swap ? s : c;
+    sin = ((q & 2) != 0) ? -ss : ss;
+    cos = (((q + 1) & 2) != 0) ? -cc : cc;
+}
+
+//
+// Array Kernels
+//
+
+#define JST_MATH_DISPATCH(ACCURACY, KERNEL) \
+    switch (ACCURACY) { \
+        case MathAccuracy::Fast:     KERNEL(MathAccuracy::Fast);     break; \
+        case MathAccuracy::Balanced: KERNEL(MathAccuracy::Balanced); break; \
+        case MathAccuracy::Exact:    KERNEL(MathAccuracy::Exact);    break; \
+    }
+
+inline void Log10(const MathAccuracy& accuracy, const F32* input, F32* output, const U64& size) {
+#define JST_MATH_KERNEL(A) for (U64 i = 0; i < size; i++) { output[i] = Log10<A>(input[i]); }
+    JST_MATH_DISPATCH(accuracy, JST_MATH_KERNEL)
+#undef JST_MATH_KERNEL
+}
+
+inline void Atan2(const MathAccuracy& accuracy, const F32* y, const F32* x, F32* output, const U64& size) {
+#define JST_MATH_KERNEL(A) for (U64 i = 0; i < size; i++) { output[i] = Atan2<A>(y[i], x[i]); }
+    JST_MATH_DISPATCH(accuracy, JST_MATH_KERNEL)
+#undef JST_MATH_KERNEL
+}
+
+inline void Exp(const MathAccuracy& accuracy, const F32* input, F32* output, const U64& size) {
+#define JST_MATH_KERNEL(A) for (U64 i = 0; i < size; i++) { output[i] = Exp<A>(input[i]); }
+    JST_MATH_DISPATCH(accuracy, JST_MATH_KERNEL)
+#undef JST_MATH_KERNEL
+}
+
+inline void SinCos(const MathAccuracy& accuracy, const F32* input, F32* sin, F32* cos, const U64& size) {
+#define JST_MATH_KERNEL(A) for (U64 i = 0; i < size; i++) { SinCos<A>(input[i], sin[i], cos[i]); }
+    JST_MATH_DISPATCH(accuracy, JST_MATH_KERNEL)
+#undef JST_MATH_KERNEL
+}
+
+#undef JST_MATH_DISPATCH
+
+}  // namespace Jetstream::Backend
+
+#endif
@@ -2,6 +2,7 @@
 #define JETSTREAM_BACKEND_DEVICE_VULKAN_HH
 
 #include <set>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -70,6 +71,21 @@ class Vulkan {
         return computeQueue;
     }
 
+    // Queue used by the compute graphs. A second queue of the compute family
+    // when available, otherwise the compute queue is shared with rendering
+    // and every submission has to hold the queue mutex.
+    constexpr VkQueue& getGraphQueue() {
+        return graphQueue;
+    }
+
+    constexpr U32 getGraphQueueFamily() const {
+        return graphQueueFamily;
+    }
+
+    std::mutex& getQueueMutex() {
+        return queueMutex;
+    }
+
     constexpr VkDescriptorPool& getDescriptorPool() {
         return descriptorPool;
     }
@@ -119,6 +135,9 @@ class Vulkan {
     VkQueue graphicsQueue;
     VkQueue computeQueue;
     VkQueue presentQueue;
+    VkQueue graphQueue;
+    U32 graphQueueFamily;
+    std::mutex queueMutex;
     std::set<std::string> availableOptionalDeviceCapabilities;
 
     struct {
@@ -22,6 +22,7 @@
 #include "jetstream/flowgraph.hh"
 #include "jetstream/parser.hh"
 #include "jetstream/benchmark.hh"
+#include "jetstream/metrics.hh"
 
 //
 // Functional Imports
@@ -4,6 +4,7 @@
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/logger.hh"
+#include "jetstream/perf_counters.hh"
 
 #include "jetstream/tools/nanobench.h"
 
@@ -16,6 +17,24 @@ class Benchmark {
         F64 ops_per_sec;
         F64 ms_per_op;
         F64 error;
+        F64 cycles_per_op = 0.0;
+        F64 ipc = 0.0;
+        F64 cache_mpki = 0.0;
+        F64 branch_mpki = 0.0;
+        F64 bytes_per_op = 0.0;
+        F64 flops_per_op = 0.0;
+        F64 gbps = 0.0;
+        F64 gflops = 0.0;
+        F64 roofline = 0.0;
+        F64 max_error = -1.0;
+    };
+
+    // Machine limits measured once per process. Bandwidth is a STREAM
+    // triad over buffers larger than the last level cache and compute
+    // is a register-only multiply-add loop on a single core.
+    struct Roofline {
+        F64 bandwidth_gbps = 0.0;
+        F64 peak_gflops = 0.0;
     };
     
     typedef std::function<void(ankerl::nanobench::Bench& bench, std::string name)> BenchmarkFuncType;
@@ -49,16 +68,51 @@ class Benchmark {
         return getInstance().getResults();
     }
 
+    static void CountersBegin() {
+        getInstance().countersBegin();
+    }
+
+    // Closes the counter window of a benchmark. Calls is the number of
+    // times the benchmarked function ran, calibration included.
+    static void CountersEnd(const std::string& name, const U64& calls) {
+        getInstance().countersEnd(name, calls);
+    }
+
+    // Bytes moved and floating-point operations of a single module call.
+    static void SetWorkload(const std::string& name, const U64& bytes, const F64& flops) {
+        getInstance().setWorkload(name, bytes, flops);
+    }
+
+    // Maximum error of approximate kernels against a reference.
+    static void SetAccuracy(const std::string& name, const F64& maxError) {
+        getInstance().setAccuracy(name, maxError);
+    }
+
+    static const Roofline& GetRoofline() {
+        return getInstance().getRoofline();
+    }
+
  private:
     static Benchmark& getInstance();
 
     BenchmarkMapType benchmarks;
     ResultMapType results;
 
+    PerfCounters counters;
+    std::unordered_map<std::string, std::pair<PerfCounters::Sample, U64>> samples;
+    std::unordered_map<std::string, std::pair<U64, F64>> workloads;
+    std::unordered_map<std::string, F64> accuracies;
+    Roofline roofline;
+
     U64 totalCount();
     U64 currentCount();
     void resetResults();
     const ResultMapType& getResults();
+    void countersBegin();
+    void countersEnd(const std::string& name, const U64& calls);
+    void setWorkload(const std::string& name, const U64& bytes, const F64& flops);
+    void setAccuracy(const std::string& name, const F64& maxError);
+    const Roofline& getRoofline();
 
     void add(const std::string& module,
              const std::string& device,
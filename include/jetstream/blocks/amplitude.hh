@@ -13,7 +13,9 @@ class Amplitude : public Block {
     // Configuration
 
     struct Config {
-        JST_SERDES();
+        std::string accuracy = "fast";
+
+        JST_SERDES(accuracy);
     };
 
     constexpr const Config& getConfig() const {
@@ -75,7 +77,9 @@ class Amplitude : public Block {
 
     Result create() {
         JST_CHECK(instance().template addModule<Jetstream::Amplitude, D, IT, OT>(
-            amplitude, "amplitude", {}, {
+            amplitude, "amplitude", {
+                .accuracy = config.accuracy,
+            }, {
                 .buffer = input.buffer,
             },
             locale().blockId
@@ -92,6 +96,37 @@ class Amplitude : public Block {
         return Result::SUCCESS;
     }
 
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Accuracy");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        static const char* accuracies[] = { "fast", "balanced", "exact" };
+        if (ImGui::BeginCombo("##amplitude-accuracy", config.accuracy.c_str())) {
+            for (const auto& accuracy : accuracies) {
+                const bool selected = (config.accuracy == accuracy);
+                if (ImGui::Selectable(accuracy, selected)) {
+                    config.accuracy = accuracy;
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (selected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
  private:
     std::shared_ptr<Jetstream::Amplitude<D, IT, OT>> amplitude;
 
@@ -139,6 +139,46 @@
 #define JETSTREAM_BLOCK_TAKE_AVAILABLE
 #endif
 
+#if defined(JETSTREAM_MODULE_SLICE_AVAILABLE)
+#include "jetstream/blocks/slice.hh"
+#define JETSTREAM_BLOCK_SLICE_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_CALLBACK_SINK_AVAILABLE)
+#include "jetstream/blocks/callback_sink.hh"
+#define JETSTREAM_BLOCK_CALLBACK_SINK_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_FRAME_AVAILABLE)
+#include "jetstream/blocks/frame.hh"
+#define JETSTREAM_BLOCK_FRAME_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_TRANSPOSE_AVAILABLE)
+#include "jetstream/blocks/transpose.hh"
+#define JETSTREAM_BLOCK_TRANSPOSE_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_CONCAT_AVAILABLE)
+#include "jetstream/blocks/concat.hh"
+#define JETSTREAM_BLOCK_CONCAT_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_TONE_BANK_AVAILABLE)
+#include "jetstream/blocks/tone_bank.hh"
+#define JETSTREAM_BLOCK_TONE_BANK_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_CFAR_AVAILABLE)
+#include "jetstream/blocks/cfar.hh"
+#define JETSTREAM_BLOCK_CFAR_AVAILABLE
+#endif
+
+#if defined(JETSTREAM_MODULE_CIC_AVAILABLE)
+#include "jetstream/blocks/cic.hh"
+#define JETSTREAM_BLOCK_CIC_AVAILABLE
+#endif
+
 #include "jetstream/blocks/squeeze_dims.hh"
 #define JETSTREAM_BLOCK_SQUEEZE_DIMS_AVAILABLE
 
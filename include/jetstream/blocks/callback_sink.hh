@@ -0,0 +1,148 @@
+#ifndef JETSTREAM_BLOCK_CALLBACK_SINK_BASE_HH
+#define JETSTREAM_BLOCK_CALLBACK_SINK_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/callback_sink.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class CallbackSink : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::string name = "";
+        bool dispatch = false;
+        U64 queueDepth = 4;
+        std::string policy = "drop";
+
+        JST_SERDES(name, dispatch, queueDepth, policy);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "callback-sink";
+    }
+
+    std::string name() const {
+        return "Callback Sink";
+    }
+
+    std::string summary() const {
+        return "Delivers tensors to user code.";
+    }
+
+    std::string description() const {
+        return "Calls a user callback registered by name with a read-only view of the input once per frame. "
+               "With dispatch enabled, frames are queued and delivered on a separate thread. "
+               "A full queue drops frames or blocks the compute depending on the policy.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::CallbackSink, D, IT>(
+            sink, "sink", {
+                .name = config.name,
+                .dispatch = config.dispatch,
+                .queueDepth = config.queueDepth,
+                .policy = config.policy,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(sink->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Name");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##name", &config.name, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Dispatch");
+        ImGui::TableSetColumnIndex(1);
+        if (ImGui::Checkbox("##dispatch", &config.dispatch)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (config.dispatch) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Dropped");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%llu", static_cast<unsigned long long>(sink->droppedFrames()));
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::CallbackSink<D, IT>> sink;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(CallbackSink, is_specialized<Jetstream::CallbackSink<D, IT>>::value &&
+                               std::is_same<OT, void>::value)
+
+#endif
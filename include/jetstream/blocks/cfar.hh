@@ -0,0 +1,245 @@
+#ifndef JETSTREAM_BLOCK_CFAR_BASE_HH
+#define JETSTREAM_BLOCK_CFAR_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/cfar.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class CFAR : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::string mode = "ca";
+        U64 training = 16;
+        U64 guard = 2;
+        F32 threshold = 10.0f;
+        F32 rank = 0.75f;
+        U64 maxDetections = 64;
+
+        JST_SERDES(mode, training, guard, threshold, rank, maxDetections);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> detections;
+        Tensor<D, U64> count;
+
+        JST_SERDES(detections, count);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputDetections() const {
+        return this->output.detections;
+    }
+
+    constexpr const Tensor<D, U64>& getOutputCount() const {
+        return this->output.count;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "cfar";
+    }
+
+    std::string name() const {
+        return "CFAR";
+    }
+
+    std::string summary() const {
+        return "Detects peaks above the local noise.";
+    }
+
+    std::string description() const {
+        return "Constant false alarm rate detector for a {bins} or {batch, bins} spectrum in dB, like the Amplitude output. "
+               "The noise of each bin is estimated from the training cells on both sides, skipping the guard cells. "
+               "The CA mode averages their linear power and the OS mode takes the rank quantile, which is more robust next to strong signals. "
+               "Bins more than the threshold above their noise are detected and each run of adjacent bins is reported once. "
+               "The output is a {max detections, 3} list of (bin, power, SNR) rows sorted by bin. Unused rows have a bin of -1 and the count output holds the number of valid rows.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::CFAR, D, IT>(
+            cfar, "cfar", {
+                .mode = config.mode,
+                .training = config.training,
+                .guard = config.guard,
+                .threshold = config.threshold,
+                .rank = config.rank,
+                .maxDetections = config.maxDetections,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("detections", output.detections, cfar->getOutputDetections()));
+        JST_CHECK(Block::LinkOutput("count", output.count, cfar->getOutputCount()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(cfar->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Mode");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        static const char* modes[] = { "ca", "os" };
+        if (ImGui::BeginCombo("##cfar-mode", config.mode.c_str())) {
+            for (const auto& mode : modes) {
+                const bool selected = (config.mode == mode);
+                if (ImGui::Selectable(mode, selected)) {
+                    config.mode = mode;
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (selected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Training Cells");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 training = config.training;
+        if (ImGui::InputFloat("##training", &training, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (training >= 1) {
+                config.training = static_cast<U64>(training);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Guard Cells");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 guard = config.guard;
+        if (ImGui::InputFloat("##guard", &guard, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (guard >= 0) {
+                config.guard = static_cast<U64>(guard);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Threshold (dB)");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 threshold = config.threshold;
+        if (ImGui::InputFloat("##threshold", &threshold, 0.5f, 1.0f, "%.1f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.threshold = threshold;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        if (config.mode == "os") {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Rank");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            F32 rank = config.rank;
+            if (ImGui::InputFloat("##rank", &rank, 0.05f, 0.1f, "%.2f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                if (rank >= 0.0f && rank <= 1.0f) {
+                    config.rank = rank;
+
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Max Detections");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 maxDetections = config.maxDetections;
+        if (ImGui::InputFloat("##max-detections", &maxDetections, 1.0f, 8.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (maxDetections >= 1) {
+                config.maxDetections = static_cast<U64>(maxDetections);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::CFAR<D, IT>> cfar;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(CFAR, is_specialized<Jetstream::CFAR<D, IT>>::value &&
+                       std::is_same<OT, void>::value)
+
+#endif
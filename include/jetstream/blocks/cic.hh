@@ -0,0 +1,230 @@
+#ifndef JETSTREAM_BLOCK_CIC_BASE_HH
+#define JETSTREAM_BLOCK_CIC_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/cic.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class CIC : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 decimation = 64;
+        U64 stages = 4;
+        U64 delay = 1;
+        bool integer = true;
+        U64 compensationTaps = 0;
+        F32 passband = 0.25f;
+
+        JST_SERDES(decimation, stages, delay, integer, compensationTaps, passband);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "cic";
+    }
+
+    std::string name() const {
+        return "CIC";
+    }
+
+    std::string summary() const {
+        return "Decimates a stream by a large ratio.";
+    }
+
+    std::string description() const {
+        return "Cascaded integrator-comb decimator for a {samples} or {batch, samples} stream. "
+               "Each stage is an integrator and a comb with the given differential delay, and the gain is normalized to one. "
+               "The state is kept across frames, so it can be the first stage of a down-conversion chain. "
+               "The integer mode is exact and its cost doesn't depend on the decimation. It expects samples within a full scale of one. "
+               "The float mode computes the same response as a FIR. "
+               "The compensation taps enable a FIR that flattens the droop of the response up to the passband, as a fraction of the output sample rate. "
+               "The number of input samples should be a multiple of the decimation.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::CIC, D, IT>(
+            cic, "cic", {
+                .decimation = config.decimation,
+                .stages = config.stages,
+                .delay = config.delay,
+                .integer = config.integer,
+                .compensationTaps = config.compensationTaps,
+                .passband = config.passband,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, cic->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(cic->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Decimation");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 decimation = config.decimation;
+        if (ImGui::InputFloat("##decimation", &decimation, 1.0f, 8.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (decimation >= 1) {
+                config.decimation = static_cast<U64>(decimation);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Stages");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 stages = config.stages;
+        if (ImGui::InputFloat("##stages", &stages, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (stages >= 1) {
+                config.stages = static_cast<U64>(stages);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Delay");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 delay = config.delay;
+        if (ImGui::InputFloat("##delay", &delay, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (delay >= 1) {
+                config.delay = static_cast<U64>(delay);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Integer");
+        ImGui::TableSetColumnIndex(1);
+        if (ImGui::Checkbox("##integer", &config.integer)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Compensation Taps");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 compensationTaps = config.compensationTaps;
+        if (ImGui::InputFloat("##compensation-taps", &compensationTaps, 2.0f, 2.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            const U64 taps = static_cast<U64>(std::max(compensationTaps, 0.0f));
+            if (taps == 0 || (taps % 2 == 1 && taps >= 3)) {
+                config.compensationTaps = taps;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Passband");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 passband = config.passband;
+        if (ImGui::InputFloat("##passband", &passband, 0.05f, 0.1f, "%.2f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (passband > 0.0f && passband <= 0.5f) {
+                config.passband = passband;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::CIC<D, IT>> cic;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(CIC, is_specialized<Jetstream::CIC<D, IT>>::value &&
+                      std::is_same<OT, void>::value)
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef JETSTREAM_BLOCK_CONCAT_BASE_HH
+#define JETSTREAM_BLOCK_CONCAT_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/concat.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Concat : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 axis = 0;
+        bool stack = false;
+
+        JST_SERDES(axis, stack);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> bufferA;
+        Tensor<D, IT> bufferB;
+
+        JST_SERDES(bufferA, bufferB);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "concat";
+    }
+
+    std::string name() const {
+        return "Concat";
+    }
+
+    std::string summary() const {
+        return "Joins two tensors along an axis.";
+    }
+
+    std::string description() const {
+        return "Joins 'bufferA' and 'bufferB' along the selected axis. With stack enabled, the inputs have the same shape "
+               "and are joined along a new axis (e.g. two {8192} channels become {2, 8192}). "
+               "When an input is a dense slot of the output (e.g. joining along the first axis), its producer writes "
+               "directly into the output and nothing is copied.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::Concat, D, IT>(
+            concat, "concat", {
+                .axis = config.axis,
+                .stack = config.stack,
+            }, {
+                .bufferA = input.bufferA,
+                .bufferB = input.bufferB,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, concat->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(concat->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Axis");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 axis = config.axis;
+        if (ImGui::InputFloat("##axis", &axis, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (axis >= 0) {
+                config.axis = static_cast<U64>(axis);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Stack");
+        ImGui::TableSetColumnIndex(1);
+        if (ImGui::Checkbox("##stack", &config.stack)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Concat<D, IT>> concat;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Concat, is_specialized<Jetstream::Concat<D, IT>>::value &&
+                         std::is_same<OT, void>::value)
+
+#endif
@@ -14,8 +14,9 @@ class FM : public Block {
 
     struct Config {
         F32 sampleRate = 240e3f;
+        std::string accuracy = "exact";
 
-        JST_SERDES(sampleRate);
+        JST_SERDES(sampleRate, accuracy);
     };
 
     constexpr const Config& getConfig() const {
@@ -79,6 +80,7 @@ class FM : public Block {
         JST_CHECK(instance().template addModule<Jetstream::FM, D, IT>(
             fm, "fm", {
                 .sampleRate = config.sampleRate,
+                .accuracy = config.accuracy,
             }, {
                 .buffer = input.buffer,
             },
@@ -112,6 +114,29 @@ class FM : public Block {
                 JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
             });
         }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Accuracy");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        static const char* accuracies[] = { "fast", "balanced", "exact" };
+        if (ImGui::BeginCombo("##fm-accuracy", config.accuracy.c_str())) {
+            for (const auto& accuracy : accuracies) {
+                const bool selected = (config.accuracy == accuracy);
+                if (ImGui::Selectable(accuracy, selected)) {
+                    config.accuracy = accuracy;
+                    JST_DISPATCH_ASYNC([&](){
+                        ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                        JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                    });
+                }
+                if (selected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
     }
 
     constexpr bool shouldDrawControl() const {
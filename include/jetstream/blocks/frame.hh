@@ -0,0 +1,155 @@
+#ifndef JETSTREAM_BLOCK_FRAME_BASE_HH
+#define JETSTREAM_BLOCK_FRAME_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/frame.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Frame : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 frameSize = 1024;
+        U64 hop = 512;
+
+        JST_SERDES(frameSize, hop);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "frame";
+    }
+
+    std::string name() const {
+        return "Frame";
+    }
+
+    std::string summary() const {
+        return "Splits a stream into overlapping frames.";
+    }
+
+    std::string description() const {
+        return "Splits a {samples} or {batch, samples} stream into {frames, frame size} frames starting every hop samples. "
+               "The frames are a strided view, so overlapping frames (e.g. a hop of half the frame size) are not copied. "
+               "The number of input samples should be a multiple of the hop.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::Frame, D, IT>(
+            frame, "frame", {
+                .frameSize = config.frameSize,
+                .hop = config.hop,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, frame->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(frame->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Frame Size");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 frameSize = config.frameSize;
+        if (ImGui::InputFloat("##frame-size", &frameSize, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (frameSize >= 1) {
+                config.frameSize = static_cast<U64>(frameSize);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Hop");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 hop = config.hop;
+        if (ImGui::InputFloat("##hop", &hop, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (hop >= 1) {
+                config.hop = static_cast<U64>(hop);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Frame<D, IT>> frame;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Frame, is_specialized<Jetstream::Frame<D, IT>>::value &&
+                        std::is_same<OT, void>::value)
+
+#endif
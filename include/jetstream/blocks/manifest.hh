@@ -174,6 +174,30 @@ inline void GetDefaultManifest(Block::ConstructorManifest& constructorManifest,
 #ifdef JETSTREAM_BLOCK_TAKE_AVAILABLE
         Blocks::Take,
 #endif
+#ifdef JETSTREAM_BLOCK_SLICE_AVAILABLE
+        Blocks::Slice,
+#endif
+#ifdef JETSTREAM_BLOCK_CALLBACK_SINK_AVAILABLE
+        Blocks::CallbackSink,
+#endif
+#ifdef JETSTREAM_BLOCK_FRAME_AVAILABLE
+        Blocks::Frame,
+#endif
+#ifdef JETSTREAM_BLOCK_TRANSPOSE_AVAILABLE
+        Blocks::Transpose,
+#endif
+#ifdef JETSTREAM_BLOCK_CONCAT_AVAILABLE
+        Blocks::Concat,
+#endif
+#ifdef JETSTREAM_BLOCK_TONE_BANK_AVAILABLE
+        Blocks::ToneBank,
+#endif
+#ifdef JETSTREAM_BLOCK_CFAR_AVAILABLE
+        Blocks::CFAR,
+#endif
+#ifdef JETSTREAM_BLOCK_CIC_AVAILABLE
+        Blocks::CIC,
+#endif
 #ifdef JETSTREAM_BLOCK_SQUEEZE_DIMS_AVAILABLE
         Blocks::SqueezeDims,
 #endif
@@ -0,0 +1,130 @@
+#ifndef JETSTREAM_BLOCK_SLICE_BASE_HH
+#define JETSTREAM_BLOCK_SLICE_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/slice.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Slice : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::string slice = "[...]";
+
+        JST_SERDES(slice);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "slice";
+    }
+
+    std::string name() const {
+        return "Slice";
+    }
+
+    std::string summary() const {
+        return "Slices the input tensor.";
+    }
+
+    std::string description() const {
+        return "Slices the input tensor with NumPy-like indexing (e.g. [0, 1:8:2, ...]). "
+               "Dense slices are zero-copy views of the input. The other slices are copied every frame.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::Slice, D, IT>(
+            slice, "slice", {
+                .slice = config.slice,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, slice->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(slice->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Slice");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##slice", &config.slice, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Slice<D, IT>> slice;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Slice, is_specialized<Jetstream::Slice<D, IT>>::value &&
+                        std::is_same<OT, void>::value)
+
+#endif
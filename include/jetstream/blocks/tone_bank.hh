@@ -0,0 +1,213 @@
+#ifndef JETSTREAM_BLOCK_TONE_BANK_BASE_HH
+#define JETSTREAM_BLOCK_TONE_BANK_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/tone_bank.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class ToneBank : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::vector<F32> frequencies = {0.0e6f};
+        F32 sampleRate = 2.0e6f;
+        U64 window = 1024;
+        U64 hop = 256;
+
+        JST_SERDES(frequencies, sampleRate, window, hop);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "tone-bank";
+    }
+
+    std::string name() const {
+        return "Tone Bank";
+    }
+
+    std::string summary() const {
+        return "Tracks a few DFT bins every hop.";
+    }
+
+    std::string description() const {
+        return "Computes the DFT of the last 'window' samples at each selected frequency with a recursive sliding DFT. "
+               "The bins are published every 'hop' samples as a {bins, samples / hop} tensor (with a leading batch axis "
+               "for batched inputs).\n\n"
+               "Each bin costs 16 flops per sample. An FFT of the same window every hop costs "
+               "5 · log2(window) · window / hop flops per sample, so the bank is cheaper for up to that many bins "
+               "divided by 16. For example, 4 bins against an 8192-point FFT without overlap, or 130 bins against the "
+               "same FFT every 256 samples.";
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_CHECK(instance().template addModule<Jetstream::ToneBank, D, IT>(
+            toneBank, "tone_bank", {
+                .frequencies = config.frequencies,
+                .sampleRate = config.sampleRate,
+                .window = config.window,
+                .hop = config.hop,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, toneBank->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(toneBank->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Sample Rate");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 sampleRate = config.sampleRate / JST_MHZ;
+        if (ImGui::InputFloat("##tone-bank-sample-rate", &sampleRate, 1.0f, 1.0f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            config.sampleRate = sampleRate * JST_MHZ;
+
+            JST_DISPATCH_ASYNC([&](){
+                ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+            });
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Window");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 window = config.window;
+        if (ImGui::InputFloat("##tone-bank-window", &window, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (window >= 1) {
+                config.window = static_cast<U64>(window);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Hop");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 hop = config.hop;
+        if (ImGui::InputFloat("##tone-bank-hop", &hop, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (hop >= 1) {
+                config.hop = static_cast<U64>(hop);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Tones");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        F32 tones = config.frequencies.size();
+        if (ImGui::InputFloat("##tone-bank-tones", &tones, 1.0f, 1.0f, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue)) {
+            if (tones >= 1 && tones != config.frequencies.size()) {
+                config.frequencies.resize(tones);
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+
+        for (U64 i = 0; i < config.frequencies.size(); i++) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("Tone #{:02}", i);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::SetNextItemWidth(-1);
+            const std::string id = fmt::format("##tone-bank-frequency-{}", i);
+            F32 frequency = config.frequencies[i] / JST_MHZ;
+            if (ImGui::InputFloat(id.c_str(), &frequency, 0.01f, 0.1f, "%.3f MHz", ImGuiInputTextFlags_EnterReturnsTrue)) {
+                config.frequencies[i] = frequency * JST_MHZ;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::ToneBank<D, IT>> toneBank;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(ToneBank, is_specialized<Jetstream::ToneBank<D, IT>>::value &&
+                           std::is_same<OT, void>::value)
+
+#endif
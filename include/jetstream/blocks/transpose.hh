@@ -0,0 +1,139 @@
+#ifndef JETSTREAM_BLOCK_TRANSPOSE_BASE_HH
+#define JETSTREAM_BLOCK_TRANSPOSE_BASE_HH
+
+#include "jetstream/block.hh"
+#include "jetstream/instance.hh"
+#include "jetstream/modules/transpose.hh"
+
+namespace Jetstream::Blocks {
+
+template<Device D, typename IT, typename OT>
+class Transpose : public Block {
+ public:
+    // Configuration
+
+    struct Config {
+        std::vector<U64> axes = {};
+
+        JST_SERDES(axes);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, IT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    std::string id() const {
+        return "transpose";
+    }
+
+    std::string name() const {
+        return "Transpose";
+    }
+
+    std::string summary() const {
+        return "Reorders the axes of the input tensor.";
+    }
+
+    std::string description() const {
+        return "Reorders the axes of the input tensor (e.g. [1, 0] turns {channels, time} into {time, channels}). "
+               "Output axis i is input axis axes[i]. Empty axes reverse the axes. "
+               "The result is copied into a dense tensor with a cache-blocked transpose.";
+    }
+
+    // Constructor
+
+    Result create() {
+        axesText = fmt::format("{}", config.axes);
+
+        JST_CHECK(instance().template addModule<Jetstream::Transpose, D, IT>(
+            transpose, "transpose", {
+                .axes = config.axes,
+            }, {
+                .buffer = input.buffer,
+            },
+            locale().blockId
+        ));
+
+        JST_CHECK(Block::LinkOutput("buffer", output.buffer, transpose->getOutputBuffer()));
+
+        return Result::SUCCESS;
+    }
+
+    Result destroy() {
+        JST_CHECK(instance().eraseModule(transpose->locale()));
+
+        return Result::SUCCESS;
+    }
+
+    // Interface
+
+    void drawControl() {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Axes");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputText("##axes", &axesText, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            std::vector<U64> axes;
+            if (Jetstream::Transpose<D, IT>::ParseAxes(axesText, axes) == Result::SUCCESS) {
+                config.axes = axes;
+
+                JST_DISPATCH_ASYNC([&](){
+                    ImGui::InsertNotification({ ImGuiToastType_Info, 1000, "Reloading block..." });
+                    JST_CHECK_NOTIFY(instance().reloadBlock(locale()));
+                });
+            }
+        }
+    }
+
+    constexpr bool shouldDrawControl() const {
+        return true;
+    }
+
+ private:
+    std::shared_ptr<Jetstream::Transpose<D, IT>> transpose;
+    std::string axesText;
+
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream::Blocks
+
+JST_BLOCK_ENABLE(Transpose, is_specialized<Jetstream::Transpose<D, IT>>::value &&
+                            std::is_same<OT, void>::value)
+
+#endif
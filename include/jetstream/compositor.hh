@@ -49,6 +49,11 @@ class JETSTREAM_API Compositor {
     Result draw();
     Result processInteractions();
 
+    // True when the interface state changed since the last draw.
+    bool redrawPending() const {
+        return stateChanged.test();
+    }
+
  private:
     typedef std::pair<std::string, Device> CreateBlockMail;
     typedef std::pair<Locale, Locale> LinkMail;
@@ -78,6 +83,21 @@ class JETSTREAM_API Compositor {
         std::unordered_map<PinId, Locale> inputs;
         std::unordered_map<PinId, Locale> outputs;
         std::unordered_set<NodeId> edges;
+
+        // Layout cache. Invalidated by `refreshState()`.
+        F32 titleWidth = 0.0f;
+        F32 titleScalingFactor = 0.0f;
+        bool titleComplete = false;
+        bool titleWarning = false;
+        bool nodePosSynced = false;
+        Size2D<F32> nodePos = {0.0f, 0.0f};
+    };
+
+    struct LinkState {
+        LinkId id;
+        PinId inputPinId;
+        PinId outputPinId;
+        std::shared_ptr<Block> outputBlock;
     };
 
     void lock();
@@ -108,6 +128,7 @@ class JETSTREAM_API Compositor {
     bool benchmarkRunning;
 
     std::atomic_flag interfaceHalt{false};
+    std::atomic_flag stateChanged{true};
 
     bool assetsLoaded = false;
     std::shared_ptr<Render::Texture> primaryBannerTexture;
@@ -124,6 +145,7 @@ class JETSTREAM_API Compositor {
     std::unordered_map<std::string, std::pair<bool, ImGuiID>> stacks;
 
     std::unordered_map<LinkId, std::pair<Locale, Locale>> linkLocaleMap;
+    std::vector<LinkState> linkStates;
     std::unordered_map<Locale, PinId, Locale::Hasher> inputLocalePinMap;
     std::unordered_map<Locale, PinId, Locale::Hasher> outputLocalePinMap;
     std::unordered_map<PinId, Locale> pinLocaleMap;
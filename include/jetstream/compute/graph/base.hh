@@ -9,6 +9,9 @@
 #ifdef JETSTREAM_GRAPH_METAL_AVAILABLE
 #include "jetstream/compute/graph/metal.hh"
 #endif
+#ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE
+#include "jetstream/compute/graph/vulkan.hh"
+#endif
 
 namespace Jetstream {
 
@@ -22,13 +25,13 @@ inline std::unique_ptr<Graph> NewGraph(const Device& device) {
 //         case Device::CUDA:
 //             return std::make_unique<CUDA>();
 // #endif
-// #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE 
-//         case Device::Vulkan:
-//             return std::make_unique<Vulkan>();
-// #endif
 #ifdef JETSTREAM_GRAPH_METAL_AVAILABLE 
         case Device::Metal:
             return std::make_unique<Metal>();
+#endif
+#ifdef JETSTREAM_GRAPH_VULKAN_AVAILABLE
+        case Device::Vulkan:
+            return std::make_unique<Vulkan>();
 #endif
         default:
             JST_ERROR("[GRAPH] Backend not supported yet.");
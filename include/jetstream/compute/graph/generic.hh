@@ -2,20 +2,39 @@
 #define JETSTREAM_COMPUTE_GRAPH_GENERIC_HH
 
 #include <set>
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "jetstream/memory/types.hh"
 #include "jetstream/metadata.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
+#include "jetstream/perf_counters.hh"
 
 namespace Jetstream { 
 
 class Graph {
  public:
+    struct ProfileEntry {
+        std::string name;
+        std::atomic<F64> msPerCompute = 0.0;
+        std::atomic<F64> ipc = 0.0;
+        std::atomic<F64> cacheMissesPerKiloInstruction = 0.0;
+    };
+
+    // Explicit copy between a staged clone and its root buffer. Recorded by
+    // the graph running on the staged device. The source is on `device`.
+    struct Transfer {
+        Device device;
+        void* source;
+        void* target;
+        U64 sizeBytes;
+    };
+
     virtual ~Graph() = default;
 
-    Result setModule(const std::shared_ptr<Compute>& block);
+    Result setModule(const std::shared_ptr<Compute>& block, const std::string& name = "");
 
     Result setWiredInput(const U64& input);
     Result setWiredOutput(const U64& output);
@@ -38,12 +57,40 @@ class Graph {
         return externallyWiredOutputSet;
     }
 
+    void setProfiling(const bool& enabled) {
+        profiling.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool isProfiling() const {
+        return profiling.load(std::memory_order_relaxed);
+    }
+
+    constexpr const std::vector<std::unique_ptr<ProfileEntry>>& getProfile() const {
+        return profile;
+    }
+
     virtual constexpr Device device() const = 0;
     virtual Result create() = 0;
     virtual Result compute() = 0;
     virtual Result computeReady() = 0;
     virtual Result destroy() = 0;
 
+    virtual Result addTransfer(const Transfer&) {
+        JST_ERROR("[GRAPH] Device {} doesn't support explicit transfers.", device());
+        return Result::ERROR;
+    }
+
+    // Points the host side of recorded transfers at rebound memory.
+    virtual Result rebindTransfers(const void*, void*) {
+        return Result::SUCCESS;
+    }
+
+    // Blocks until the work submitted by the last compute is done and its
+    // outputs are visible to the host. Synchronous graphs return right away.
+    virtual Result synchronize() {
+        return Result::SUCCESS;
+    }
+
  protected:
     std::shared_ptr<RuntimeMetadata> metadata;
     std::vector<std::shared_ptr<Compute>> blocks;
@@ -51,6 +98,15 @@ class Graph {
     std::set<U64> wiredOutputSet;
     std::set<U64> externallyWiredInputSet;
     std::set<U64> externallyWiredOutputSet;
+
+    // Per-block profiler. Must be called from the thread computing the graph.
+    void profileBegin();
+    void profileEnd(const U64& index);
+
+ private:
+    std::atomic_bool profiling{false};
+    std::chrono::steady_clock::time_point profileStart;
+    std::vector<std::unique_ptr<ProfileEntry>> profile;
 };
 
 }  // namespace Jetstream
@@ -0,0 +1,105 @@
+#ifndef JETSTREAM_COMPUTE_GRAPH_VULKAN_HH
+#define JETSTREAM_COMPUTE_GRAPH_VULKAN_HH
+
+#include <array>
+
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/generic.hh"
+
+namespace Jetstream {
+
+class Vulkan : public Graph {
+ public:
+    Vulkan();
+    ~Vulkan();
+
+    constexpr Device device() const {
+        return Device::Vulkan;
+    }
+
+    Result create();
+    Result compute();
+    Result computeReady();
+    Result destroy();
+
+    Result addTransfer(const Transfer& transfer);
+    Result rebindTransfers(const void* previous, void* current);
+    Result synchronize();
+
+    // Compute pipeline of a single GLSL kernel. Every buffer is bound as a
+    // storage buffer in the order they were declared (binding 0, 1, ...).
+
+    struct Kernel {
+        VkShaderModule shaderModule = VK_NULL_HANDLE;
+        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        U64 numberOfBuffers = 0;
+        U64 pushConstantsSize = 0;
+    };
+
+    // Workgroup size expected by the dispatch (`layout(local_size_x = 256)`).
+    static constexpr U64 LocalSize = 256;
+
+    static Result CompileKernel(const char* shaderSrc,
+                                const U64& numberOfBuffers,
+                                const U64& pushConstantsSize,
+                                Kernel& kernel);
+
+    static Result BindBuffers(Kernel& kernel, const std::vector<VkBuffer>& buffers);
+
+    template<typename PushConstantsType>
+    static Result Dispatch(const RuntimeMetadata& meta,
+                           const Kernel& kernel,
+                           const PushConstantsType& constants,
+                           const U64& numberOfThreads) {
+        return dispatch(meta, kernel, &constants, sizeof(PushConstantsType), numberOfThreads);
+    }
+
+    static Result Dispatch(const RuntimeMetadata& meta,
+                           const Kernel& kernel,
+                           const U64& numberOfThreads) {
+        return dispatch(meta, kernel, nullptr, 0, numberOfThreads);
+    }
+
+    static Result DestroyKernel(Kernel& kernel);
+
+ private:
+    // Frames are double-buffered. While the device works on one slot, the
+    // host fills the staging area of the other with the next frame.
+    static constexpr U64 NumberOfSlots = 2;
+
+    struct Slot {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        bool pending = false;
+        U64 sequence = 0;
+    };
+
+    std::array<Slot, NumberOfSlots> slots;
+    U64 currentSlot = 0;
+    U64 sequence = 0;
+
+    std::vector<Transfer> uploads;
+    std::vector<Transfer> downloads;
+
+    VkBuffer stagingBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+    U8* stagingMappedMemory = nullptr;
+    U64 stagingSlotSize = 0;
+
+    Result createStaging();
+    Result destroyStaging();
+    Result complete(Slot& slot);
+
+    static Result dispatch(const RuntimeMetadata& meta,
+                           const Kernel& kernel,
+                           const void* constants,
+                           const U64& constantsSize,
+                           const U64& numberOfThreads);
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef JETSTREAM_COMPUTE_SCHEDULER_HH
 #define JETSTREAM_COMPUTE_SCHEDULER_HH
 
+#include <map>
 #include <memory>
 #include <stack>
+#include <future>
 #include <ranges>
 #include <vector>
 #include <chrono>
@@ -12,6 +14,7 @@
 #include <unordered_set>
 
 #include "jetstream/compute/graph/base.hh"
+#include "jetstream/metrics.hh"
 
 namespace Jetstream {
 
@@ -26,8 +29,28 @@ class JETSTREAM_API Scheduler {
     Result removeModule(const Locale& locale);
     Result compute();
     Result present();
+
+    // Computes one frame without sleeping or waiting for sources. Returns
+    // SKIP if a graph is not ready. Outputs are synchronized on return.
+    Result step();
+
+    // Points staged transfers reading or writing `previous` at `current`.
+    Result rebindTransfers(const void* previous, void* current);
+
     Result destroy();
 
+    void setProfiling(const bool& enabled);
+
+    bool isProfiling() const {
+        return profiling;
+    }
+
+    // True when a frame was computed since the last present.
+    bool presentPending() const {
+        return !validPresentModuleStates.empty() &&
+               computedSequence.load(std::memory_order_relaxed) != presentedSequence;
+    }
+
     void drawDebugMessage() const;
 
  private:
@@ -48,6 +71,22 @@ class JETSTREAM_API Scheduler {
         std::shared_ptr<Present> module;
         Parser::RecordMap inputMap;
         Parser::RecordMap outputMap;
+        Latency::Tracker latency;
+        U64 lastSequence = 0;
+    };
+
+    // Independent clusters placed on a NUMA node. Only used on multi-node
+    // machines when every graph runs on the CPU.
+    struct NumaCluster {
+        I64 node;
+        std::vector<std::shared_ptr<Graph>> graphs;
+    };
+
+    struct FrameTiming {
+        Latency::Timestamp capture;
+        Latency::Timestamp computeStart;
+        Latency::Timestamp computeEnd;
+        U64 sequence = 0;
     };
 
     std::mutex sharedMutex;
@@ -67,14 +106,41 @@ class JETSTREAM_API Scheduler {
     std::unordered_map<std::string, PresentModuleState> validPresentModuleStates;
 
     bool running = true;
+    bool profiling = false;
+    FrameTiming computedFrame;
+    std::atomic<U64> computedSequence{0};
+    U64 presentedSequence = 0;
+
+    Metrics::Counter& computeFramesCounter = Metrics::GetCounter("jetstream_scheduler_compute_frames_total",
+                                                                 "Number of frames computed by the scheduler.");
+    Metrics::Counter& skippedFramesCounter = Metrics::GetCounter("jetstream_scheduler_skipped_frames_total",
+                                                                 "Number of frames skipped due to a graph underrun.");
+    Metrics::Counter& presentFramesCounter = Metrics::GetCounter("jetstream_scheduler_present_frames_total",
+                                                                 "Number of frames presented by the scheduler.");
+    Metrics::Gauge& computeTimeGauge = Metrics::GetGauge("jetstream_scheduler_compute_seconds",
+                                                         "Duration of the last compute cycle.");
+    Metrics::Gauge& computeBlocksGauge = Metrics::GetGauge("jetstream_scheduler_compute_blocks",
+                                                           "Number of active compute blocks.");
+    Metrics::Gauge& presentBlocksGauge = Metrics::GetGauge("jetstream_scheduler_present_blocks",
+                                                           "Number of active present blocks.");
     std::vector<std::shared_ptr<Graph>> graphs;
+    std::vector<std::vector<std::shared_ptr<Graph>>> graphDependencies;
+    std::vector<std::shared_ptr<TensorStorageMetadata::CopyOnWrite>> copyOnWriteVectors;
+    std::vector<NumaCluster> numaClusters;
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    Backend::CPU* numaBackend = nullptr;
+#endif
     ExecutionOrder executionOrder;
     DeviceExecutionOrder deviceExecutionOrder;
 
+    Result computeFrame();
     Result removeInactive();
     Result arrangeDependencyOrder();
     Result checkSequenceValidity();
     Result createExecutionGraphs();
+    Result placeGatheredInputs();
+    Result placeNumaClusters(const std::vector<U64>& graphClusters);
+    Result computeNumaClusters();
 
     Result lockState(const std::function<Result()>& func);
 };
@@ -87,6 +87,13 @@ class JETSTREAM_API Flowgraph {
     }
     Result setDescription(const std::string& description);
 
+    // CPU backend settings (`workers`, `computeCore`, `renderCore`,
+    // `sourceCore`, `realtimePriority`, and `lockMemory`).
+    constexpr const std::map<std::string, std::string>& cpuSettings() const {
+        return _cpuSettings;
+    }
+    Result setCpuSettings(const std::map<std::string, std::string>& settings);
+
     // Manifest, and metadata.
 
     struct Metadata {
@@ -180,8 +187,10 @@ class JETSTREAM_API Flowgraph {
     std::string _author;
     std::string _license;
     std::string _description;
+    std::map<std::string, std::string> _cpuSettings;
 
     Result importFromBlob();
+    Result applyCpuSettings();
 
     // YAML.
 
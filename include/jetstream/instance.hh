@@ -344,6 +344,57 @@ class JETSTREAM_API Instance {
     Result present();
     Result end();
 
+    // Pull Mode
+    //
+    // Drives the graph from the caller loop instead of a compute thread.
+    // A graph input is a CPU tensor wrapping caller memory with a locale
+    // set by the caller. `push()` points it at new memory, `step()`
+    // computes one frame and `pull()` returns an output without copying.
+    //
+    //     Tensor<Device::CPU, CF32> samples(hostMemory, {8, 8192});
+    //     samples.set_locale({"host", "", "samples"});
+    //     ...
+    //     JST_CHECK(instance.push({"host", "", "samples"}, nextHostMemory));
+    //     JST_CHECK(instance.step());
+    //     JST_CHECK(instance.pull({"scl", "scl", "buffer"}, spectrum));
+
+    template<typename T>
+    Result push(const Locale& locale, T* data) {
+        Parser::Record* record = nullptr;
+        JST_CHECK(findInputRecord(locale, record));
+
+        auto* tensor = std::any_cast<Tensor<Device::CPU, T>>(&record->object);
+        if (!tensor) {
+            JST_ERROR("[INSTANCE] Graph input '{}' is not a CPU tensor of type {}.",
+                      locale, NumericTypeInfo<T>::name);
+            return Result::ERROR;
+        }
+
+        void* previous = tensor->data();
+        JST_CHECK(tensor->rebind(data));
+
+        return updateRebound(previous, data);
+    }
+
+    Result step();
+
+    template<Device D, typename T>
+    Result pull(const Locale& locale, Tensor<D, T>& output) {
+        Parser::Record* record = nullptr;
+        JST_CHECK(findOutputRecord(locale, record));
+
+        auto* tensor = std::any_cast<Tensor<D, T>>(&record->object);
+        if (!tensor) {
+            JST_ERROR("[INSTANCE] Output '{}' is not a {} tensor of type {}.",
+                      locale, D, NumericTypeInfo<T>::name);
+            return Result::ERROR;
+        }
+
+        output = *tensor;
+
+        return Result::SUCCESS;
+    }
+
     Compositor& compositor() {
         return _compositor;
     }
@@ -373,6 +424,9 @@ class JETSTREAM_API Instance {
     std::shared_ptr<Viewport::Generic> _viewport;
 
     Result fetchDependencyTree(Locale locale, std::vector<Locale>& storage);
+    Result findInputRecord(const Locale& locale, Parser::Record*& record);
+    Result findOutputRecord(const Locale& locale, Parser::Record*& record);
+    Result updateRebound(const void* previous, void* current);
 
     Result blockUpdater(Locale locale, const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater);
 };
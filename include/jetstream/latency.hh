@@ -0,0 +1,77 @@
+#ifndef JETSTREAM_LATENCY_HH
+#define JETSTREAM_LATENCY_HH
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+#include "jetstream/metrics.hh"
+
+namespace Jetstream {
+
+// End-to-end sample latency. Sources stamp the capture time of the samples,
+// the scheduler carries it through the compute graphs to every output. Each
+// output keeps one histogram per stage in the metrics registry.
+
+class JETSTREAM_API Latency {
+ public:
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point Timestamp;
+
+    enum class Stage : U8 {
+        RingBuffer   = 0,
+        Compute      = 1,
+        PresentQueue = 2,
+        Encode       = 3,
+        Total        = 4,
+    };
+
+    static constexpr U64 StageCount = 5;
+
+    static constexpr const char* StageToString(const Stage& stage) {
+        switch (stage) {
+            case Stage::RingBuffer:
+                return "ring_buffer";
+            case Stage::Compute:
+                return "compute";
+            case Stage::PresentQueue:
+                return "present_queue";
+            case Stage::Encode:
+                return "encode";
+            case Stage::Total:
+                return "total";
+        }
+        return "unknown";
+    }
+
+    class JETSTREAM_API Tracker {
+     public:
+        Tracker() = default;
+        explicit Tracker(const std::string& output);
+
+        void record(const Stage& stage, const Clock::duration& duration) {
+            if (histograms[static_cast<U8>(stage)]) {
+                histograms[static_cast<U8>(stage)]->observe(std::chrono::duration<F64>(duration).count());
+            }
+        }
+
+        const Metrics::Histogram* histogram(const Stage& stage) const {
+            return histograms[static_cast<U8>(stage)];
+        }
+
+     private:
+        std::array<Metrics::Histogram*, StageCount> histograms{};
+    };
+
+    // Capture time of the frame currently being displayed. Written by the
+    // scheduler during present and read by the viewport endpoint.
+    static void SetDisplayed(const Timestamp& timestamp);
+    static Timestamp Displayed();
+};
+
+}  // namespace Jetstream
+
+#endif
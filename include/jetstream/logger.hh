@@ -3,7 +3,10 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <mutex>
+#include <cstdint>
+#include <algorithm>
 
 #include <fmt/format.h>
 #include <fmt/color.h>
@@ -24,11 +27,116 @@ void JST_LOG_SET_DEBUG_LEVEL(int level);
 #define JST_LOG_DEBUG_DEFAULT_LEVEL 2
 #endif
 
+// Levels above this are removed at compile time.
+#ifndef JST_LOG_MAX_LEVEL
+#ifdef JST_DEBUG_MODE
+#define JST_LOG_MAX_LEVEL 4
+#else
+#define JST_LOG_MAX_LEVEL 3
+#endif
+#endif
+
 std::mutex& _JST_LOG_MUTEX();
 int& _JST_LOG_DEBUG_LEVEL();
 
+// Records are formatted by the caller into a preallocated slot of a lock-free
+// queue and printed by a background thread. Identical consecutive messages
+// are collapsed. Errors and fatal messages are printed synchronously, and so
+// are messages longer than a record.
+
+enum class _JST_LOG_TYPE : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Fatal,
+};
+
+struct _JST_LOG_RECORD {
+    static constexpr size_t Capacity = 496;
+
+    _JST_LOG_TYPE type;
+    bool spilled;
+    uint16_t size;
+    char text[Capacity];
+};
+
+_JST_LOG_RECORD* _JST_LOG_ACQUIRE(const _JST_LOG_TYPE& type, uint64_t& ticket);
+void _JST_LOG_COMMIT(const uint64_t& ticket);
+void _JST_LOG_WRITE_SYNC(const _JST_LOG_RECORD& record);
+void _JST_LOG_WRITE_SYNC(const _JST_LOG_TYPE& type, const std::string_view& text);
+void _JST_LOG_FLUSH();
+
+// Keeps the last message of a level. The string is only written when the
+// text changes, so repeated messages don't allocate.
+inline void _JST_LOG_REMEMBER(std::string* last, const std::string_view& text) {
+    if (last != nullptr && *last != text) {
+        last->assign(text);
+    }
+}
+
+// Returns false if the message doesn't fit in the record. Spilled records
+// are skipped by the printer and the caller writes the full text instead.
+template<typename... Args>
+inline bool _JST_LOG_FILL(_JST_LOG_RECORD& record,
+                          const _JST_LOG_TYPE& type,
+                          fmt::format_string<Args...> format,
+                          Args&&... args) {
+    const auto result = fmt::format_to_n(record.text, _JST_LOG_RECORD::Capacity,
+                                         format, std::forward<Args>(args)...);
+    record.type = type;
+    record.size = static_cast<uint16_t>(std::min(result.size, _JST_LOG_RECORD::Capacity));
+    record.spilled = (result.size > _JST_LOG_RECORD::Capacity);
+
+    return !record.spilled;
+}
+
+template<typename... Args>
+inline void _JST_LOG_SPILL(const _JST_LOG_TYPE& type,
+                           std::string* last,
+                           fmt::format_string<Args...> format,
+                           Args&&... args) {
+    const auto text = fmt::format(format, std::forward<Args>(args)...);
+    _JST_LOG_REMEMBER(last, text);
+    _JST_LOG_WRITE_SYNC(type, text);
+}
+
+template<typename... Args>
+inline void _JST_LOG_PUSH(const _JST_LOG_TYPE& type,
+                          std::string* last,
+                          fmt::format_string<Args...> format,
+                          Args&&... args) {
+    // Trace and debug messages are dropped if the queue is full,
+    // other levels fall back to a synchronous write.
+    uint64_t ticket;
+    if (type < _JST_LOG_TYPE::Error) {
+        if (auto* record = _JST_LOG_ACQUIRE(type, ticket)) {
+            if (_JST_LOG_FILL(*record, type, format, std::forward<Args>(args)...)) {
+                _JST_LOG_REMEMBER(last, {record->text, record->size});
+            } else {
+                // The printer stops at this uncommitted slot, so the long
+                // message keeps its place in the output.
+                _JST_LOG_SPILL(type, last, format, std::forward<Args>(args)...);
+            }
+            _JST_LOG_COMMIT(ticket);
+            return;
+        }
+        if (type < _JST_LOG_TYPE::Info) {
+            return;
+        }
+    }
+
+    _JST_LOG_RECORD record;
+    if (!_JST_LOG_FILL(record, type, format, std::forward<Args>(args)...)) {
+        _JST_LOG_SPILL(type, last, format, std::forward<Args>(args)...);
+        return;
+    }
+    _JST_LOG_REMEMBER(last, {record.text, record.size});
+    _JST_LOG_WRITE_SYNC(record);
+}
+
 #define _JST_LOG_SINK          std::cout
-#define _JST_LOG_ENDL          std::endl;
 #define _JST_LOG_FORMAT        fmt::format
 
 // TODO: Make this a environment variable.
@@ -56,86 +164,45 @@ int& _JST_LOG_DEBUG_LEVEL();
 #define _JST_LOG_FATAL         _JST_LOG_BOLD("[FATAL] ")
 
 #ifndef JST_TRACE
-#ifdef JST_DEBUG_MODE
+#if JST_LOG_MAX_LEVEL >= 4
 #define JST_TRACE(...) if (_JST_LOG_DEBUG_LEVEL() >= 4) { \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                 << \
-                       _JST_LOG_NAME                 << \
-                       _JST_LOG_TRACE                << \
-                       _JST_LOG_SEPR                 << \
-                       _JST_LOG_DEFAULT(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_PUSH(_JST_LOG_TYPE::Trace, nullptr, __VA_ARGS__); }
 #else
 #define JST_TRACE(...)
 #endif
 #endif
 
 #ifndef JST_DEBUG
+#if JST_LOG_MAX_LEVEL >= 3
 #define JST_DEBUG(...) if (_JST_LOG_DEBUG_LEVEL() >= 3) { \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                << \
-                       _JST_LOG_NAME                << \
-                       _JST_LOG_DEBUG               << \
-                       _JST_LOG_SEPR                << \
-                       _JST_LOG_ORANGE(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
+                       _JST_LOG_PUSH(_JST_LOG_TYPE::Debug, nullptr, __VA_ARGS__); }
 #else
 #define JST_DEBUG(...)
 #endif
+#endif
 
 #ifndef JST_INFO
+#if JST_LOG_MAX_LEVEL >= 2
 #define JST_INFO(...) if (_JST_LOG_DEBUG_LEVEL() >= 2) { \
-                      std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                      _JST_LOG_SINK              << \
-                      _JST_LOG_NAME              << \
-                      _JST_LOG_INFO              << \
-                      _JST_LOG_SEPR              << \
-                      _JST_LOG_CYAN(__VA_ARGS__) << \
-                      _JST_LOG_ENDL; }
+                      _JST_LOG_PUSH(_JST_LOG_TYPE::Info, nullptr, __VA_ARGS__); }
 #else
 #define JST_INFO(...)
 #endif
+#endif
 
 #ifndef JST_WARN
 #define JST_WARN(...) if (_JST_LOG_DEBUG_LEVEL() >= 1) { \
-                      JST_LOG_LAST_WARNING() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                      std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                      _JST_LOG_SINK                << \
-                      _JST_LOG_NAME                << \
-                      _JST_LOG_WARN                << \
-                      _JST_LOG_SEPR                << \
-                      _JST_LOG_YELLOW(__VA_ARGS__) << \
-                      _JST_LOG_ENDL; }
-#else
-#define JST_WARN(...)
+                      _JST_LOG_PUSH(_JST_LOG_TYPE::Warn, &JST_LOG_LAST_WARNING(), __VA_ARGS__); }
 #endif
 
 #ifndef JST_ERROR
 #define JST_ERROR(...) if (_JST_LOG_DEBUG_LEVEL() >= 0) { \
-                       JST_LOG_LAST_ERROR() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK             << \
-                       _JST_LOG_NAME             << \
-                       _JST_LOG_ERROR            << \
-                       _JST_LOG_SEPR             << \
-                       _JST_LOG_RED(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
-#else
-#define JST_ERROR(...)
+                       _JST_LOG_PUSH(_JST_LOG_TYPE::Error, &JST_LOG_LAST_ERROR(), __VA_ARGS__); }
 #endif
 
 #ifndef JST_FATAL
 #define JST_FATAL(...) if (_JST_LOG_DEBUG_LEVEL() >= 0) { \
-                       JST_LOG_LAST_FATAL() = _JST_LOG_DEFAULT(__VA_ARGS__); \
-                       std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX()); \
-                       _JST_LOG_SINK                 << \
-                       _JST_LOG_NAME                 << \
-                       _JST_LOG_FATAL                << \
-                       _JST_LOG_SEPR                 << \
-                       _JST_LOG_MAGENTA(__VA_ARGS__) << \
-                       _JST_LOG_ENDL; }
-#else
-#define JST_FATAL(...)
+                       _JST_LOG_PUSH(_JST_LOG_TYPE::Fatal, &JST_LOG_LAST_FATAL(), __VA_ARGS__); }
 #endif
 
 #endif
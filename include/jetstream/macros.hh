@@ -79,6 +79,9 @@
             input = _i; \
             under_benchmark = true; \
         }; \
+        U64 benchmark_bytes() const { \
+            return input.size_bytes() + output.size_bytes(); \
+        }; \
     protected: \
         Config config; \
         Input input; \
@@ -144,9 +147,18 @@
         module->create(); \
         graph->setModule(module); \
         graph->create(); \
+        U64 calls = 0; \
+        Benchmark::CountersBegin(); \
         bench.run(name + TestName, [&] { \
             graph->compute(); \
+            calls++; \
         }); \
+        Benchmark::CountersEnd(name + TestName, calls); \
+        F64 flops = 0.0; \
+        if constexpr (requires { module->benchmark_flops(); }) { \
+            flops = module->benchmark_flops(); \
+        } \
+        Benchmark::SetWorkload(name + TestName, module->benchmark_bytes(), flops); \
         graph->destroy(); \
         module->destroy(); \
     }
@@ -182,12 +194,22 @@
     JST_CHECK(Module::InitInput(var));
 #endif  // JST_INIT_INPUT_ACTION
 
+#ifndef JST_SIZE_BYTES_ACTION
+#define JST_SIZE_BYTES_ACTION(var) \
+    total += var.size_bytes();
+#endif  // JST_SIZE_BYTES_ACTION
+
 #ifndef JST_SERDES_INPUT
 #define JST_SERDES_INPUT(...) \
     JST_SERDES(__VA_ARGS__) \
     Result init() { \
         FOR_EACH(JST_INIT_INPUT_ACTION, __VA_ARGS__) \
         return Result::SUCCESS; \
+    } \
+    U64 size_bytes() const { \
+        U64 total = 0; \
+        FOR_EACH(JST_SIZE_BYTES_ACTION, __VA_ARGS__) \
+        return total; \
     }
 #endif  // JST_SERDES_INPUT
 
@@ -202,6 +224,11 @@
     Result init(const Locale& locale) { \
         FOR_EACH(JST_INIT_OUTPUT_ACTION, __VA_ARGS__) \
         return Result::SUCCESS; \
+    } \
+    U64 size_bytes() const { \
+        U64 total = 0; \
+        FOR_EACH(JST_SIZE_BYTES_ACTION, __VA_ARGS__) \
+        return total; \
     }
 #endif  // JST_SERDES_OUTPUT
 
@@ -11,6 +11,7 @@
 #include "jetstream/memory/devices/cpu/buffer.hh"
 #include "jetstream/memory/devices/cpu/copy.hh"
 #include "jetstream/memory/devices/cpu/tensor.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
 #endif
 
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
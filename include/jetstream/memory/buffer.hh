@@ -2,12 +2,15 @@
 #define JETSTREAM_MEMORY_BUFFER_H
 
 #include <mutex>
+#include <deque>
 #include <memory>
+#include <new>
 #include <condition_variable>
 #include <chrono>
 #include <complex>
 
 #include "jetstream/types.hh"
+#include "jetstream/metrics.hh"
 
 namespace Jetstream::Memory {
 
@@ -28,6 +31,10 @@ public:
 
     Result waitBufferOccupancy(const U64& occupancy);
 
+    // Publishes overflows, underruns, occupancy and throughput
+    // to the metrics registry under the `buffer` label.
+    void publishMetrics(const std::string& name);
+
     constexpr U64 getCapacity() const {
         return capacity;
     }
@@ -44,12 +51,26 @@ public:
         return overflows;
     }
 
+    // Time when the oldest sample of the last get() was written.
+    constexpr const std::chrono::steady_clock::time_point& getCaptureTime() const {
+        return captureTime;
+    }
+
 private:
     std::mutex io_mtx;
     std::mutex sync_mtx;
     std::condition_variable semaphore;
 
-    std::unique_ptr<T[]> buffer{};
+    // Page aligned so the pages can be bound to the NUMA node of the consumer.
+    struct AlignedDeleter {
+        void operator()(T* ptr) const {
+            ::operator delete[](ptr, std::align_val_t(JST_PAGESIZE()));
+        }
+    };
+
+    std::unique_ptr<T[], AlignedDeleter> buffer{};
+
+    void allocate();
 
     U64 transfers;
     F64 throughput;
@@ -60,6 +81,16 @@ private:
     U64 capacity;
     U64 occupancy;
     U64 overflows;
+
+    U64 totalWritten;
+    U64 totalRead;
+    std::deque<std::pair<U64, std::chrono::steady_clock::time_point>> captures;
+    std::chrono::steady_clock::time_point captureTime;
+
+    Metrics::Counter* overflowsCounter = nullptr;
+    Metrics::Counter* underrunsCounter = nullptr;
+    Metrics::Gauge* throughputGauge = nullptr;
+    Metrics::Gauge* occupancyGauge = nullptr;
 };
 
 }  // namespace Jetstream::Memory
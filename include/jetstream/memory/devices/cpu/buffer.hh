@@ -22,6 +22,13 @@ class TensorBuffer<Device::CPU> {
                           const TensorPrototypeMetadata& prototype,
                           void* ptr);
 
+    // Borrows the memory of another CPU buffer until it's written.
+    explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
+                          const TensorPrototypeMetadata& prototype,
+                          const std::shared_ptr<TensorBuffer<Device::CPU>>& source_buffer,
+                          const U64& source_offset_bytes,
+                          const U64& source_hash);
+
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                           const TensorPrototypeMetadata& prototype,
@@ -45,22 +52,54 @@ class TensorBuffer<Device::CPU> {
     TensorBuffer(const TensorBuffer&) = delete;
     TensorBuffer& operator=(const TensorBuffer&) = delete;
 
-    constexpr const void* data() const noexcept {
-        return buffer;
+    const void* data() const noexcept {
+        return (copy_on_write) ? borrowed() : buffer;
     }
 
-    constexpr void* data() noexcept {
-        return buffer;
+    void* data() noexcept {
+        return (copy_on_write) ? borrowed() : buffer;
     }
 
+    Result make_writable() {
+        return (copy_on_write) ? copy_on_write->write(source()) : Result::SUCCESS;
+    }
+
+    // Points a buffer created from a raw pointer at new caller memory.
+    // Every tensor sharing this buffer sees the new memory.
+    Result rebind(void* ptr);
+
+    // Releases the memory of an owned buffer and points it at `target`
+    // shifted by `offset_bytes`. The target is kept alive by this buffer.
+    // Every tensor sharing this buffer sees the new memory. A buffer is
+    // placed once. Placing it again into the same slot does nothing.
+    Result place(const std::shared_ptr<TensorBuffer<Device::CPU>>& target,
+                 const U64& offset_bytes,
+                 const U64& size_bytes);
+
  private:
     void* buffer = nullptr;
+    std::shared_ptr<TensorStorageMetadata::CopyOnWrite> copy_on_write;
+    std::shared_ptr<TensorBuffer<Device::CPU>> source_buffer;
     bool owns_data = false;
+    U64 allocated_bytes = 0;
+    bool hosts_placed = false;
     Device external_memory_device = Device::None;
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
     VkDeviceMemory vulkan_memory = VK_NULL_HANDLE;
 #endif
+
+    U64 source_offset_bytes = 0;
+
+    void allocate(const TensorPrototypeMetadata& prototype);
+
+    void* source() const noexcept {
+        return static_cast<U8*>(source_buffer->data()) + source_offset_bytes;
+    }
+
+    void* borrowed() const noexcept {
+        return (copy_on_write->copy) ? copy_on_write->copy : source();
+    }
 };
 
 }  // namespace Jetstream
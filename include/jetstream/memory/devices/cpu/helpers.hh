@@ -1,8 +1,11 @@
 #ifndef JETSTREAM_MEMORY_CPU_HELPERS_HH
 #define JETSTREAM_MEMORY_CPU_HELPERS_HH
 
+#include <algorithm>
+
 #include "jetstream/types.hh"
 #include "jetstream/memory/types.hh"
+#include "jetstream/backend/devices/cpu/base.hh"
 
 namespace Jetstream::Memory::CPU {
 
@@ -12,7 +15,7 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
     const U64 rank = std::get<0>(std::forward_as_tuple(args...)).rank();
 
     const auto loop = [&]<class... Iterator>(Iterator&... iter) {
-        std::array<U64, sizeof...(Args)> ptr = {args.offset()...};
+        std::array<U64, sizeof...(Args)> ptr = {};
         std::array<std::array<U64, 16>, sizeof...(Args)> coords = {};
 
         const std::array<const U64*, sizeof...(Args)> backstride = {args.backstride().data()...};
@@ -104,6 +107,64 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
         return;
     }
 
+    // Permuted
+
+    // An argument whose last axis isn't faster than the one before it (e.g. a
+    // permuted view) is walked in square tiles over the last two axes. Going
+    // row by row would touch a new cache line for every element.
+
+    const auto permuted = [&](const auto& arg) {
+        const auto& stride = arg.stride();
+        return stride[rank - 2] != 0 && stride[rank - 1] > stride[rank - 2];
+    };
+
+    if ((permuted(args) || ...)) {
+        const U64 tile = Backend::CPU::GetTileSize(std::max({sizeof(*args.data())...}));
+
+        const auto& shape = std::get<0>(std::forward_as_tuple(args...)).shape();
+        const std::array<const U64*, sizeof...(Args)> stride = {args.stride().data()...};
+
+        const U64 rows = shape[rank - 2];
+        const U64 cols = shape[rank - 1];
+        const U64 batches = size / (rows * cols);
+
+        std::array<U64, sizeof...(Args)> base;
+
+        for (U64 b = 0; b < batches; b++) {
+            base.fill(0);
+
+            U64 rest = b;
+            for (I64 d = rank - 3; d >= 0; d--) {
+                const U64 coord = rest % shape[d];
+                rest /= shape[d];
+
+                for (U64 x = 0; x < sizeof...(Args); x++) {
+                    base[x] += coord * stride[x][d];
+                }
+            }
+
+            for (U64 r0 = 0; r0 < rows; r0 += tile) {
+                const U64 r1 = std::min(r0 + tile, rows);
+
+                for (U64 c0 = 0; c0 < cols; c0 += tile) {
+                    const U64 c1 = std::min(c0 + tile, cols);
+
+                    for (U64 r = r0; r < r1; r++) {
+                        for (U64 c = c0; c < c1; c++) {
+                            [&]<size_t... Is>(std::index_sequence<Is...>) __attribute__((always_inline)) {
+                                function(std::get<Is>(std::forward_as_tuple(args.data()...))[base[Is] +
+                                                                                             r * stride[Is][rank - 2] +
+                                                                                             c * stride[Is][rank - 1]]...);
+                            }(std::index_sequence_for<Args...>{});
+                        }
+                    }
+                }
+            }
+        }
+
+        return;
+    }
+
     // 2D
 
     const std::array<bool, sizeof...(Args)> contiguous = {args.contiguous()...};
@@ -200,6 +261,35 @@ inline void AutomaticIterator(const Function& function, Args&... args) {
     JST_CHECK_THROW(Result::FATAL);
 }
 
+// Writes the transpose of a rows x cols matrix: out[c * outStride + r] =
+// in[r * inStride + c]. Works on square tiles so the reads and the writes of
+// a tile both stay in the L1 cache.
+
+template<typename T>
+inline void BlockedTranspose(const T* in,
+                             T* out,
+                             const U64& rows,
+                             const U64& cols,
+                             const U64& inStride,
+                             const U64& outStride) {
+    const U64 tile = Backend::CPU::GetTileSize(sizeof(T));
+
+    for (U64 r0 = 0; r0 < rows; r0 += tile) {
+        const U64 r1 = std::min(r0 + tile, rows);
+
+        for (U64 c0 = 0; c0 < cols; c0 += tile) {
+            const U64 c1 = std::min(c0 + tile, cols);
+
+            for (U64 r = r0; r < r1; r++) {
+                const T* src = in + r * inStride;
+                for (U64 c = c0; c < c1; c++) {
+                    out[c * outStride + r] = src[c];
+                }
+            }
+        }
+    }
+}
+
 }  // namespace Jetstream::Memory::CPU
 
 #endif
@@ -0,0 +1,24 @@
+#ifndef JETSTREAM_MEMORY_CPU_POOL_HH
+#define JETSTREAM_MEMORY_CPU_POOL_HH
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+
+namespace Jetstream {
+
+// Page-aligned host blocks recycled between frames. Used for the private
+// copies of copy-on-write tensors. Blocks are kept in free lists by size
+// and only returned to the system by `Trim()`.
+
+class JETSTREAM_API TensorPool {
+ public:
+    static void* Acquire(const U64& sizeBytes);
+    static void Release(void* ptr, const U64& sizeBytes);
+
+    static U64 Cached();
+    static void Trim();
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -15,12 +15,69 @@ class Tensor<Device::CPU, T> : public TensorBase<Device::CPU, T> {
 
     Tensor(const TensorBase<Device::CPU, T>& base) : TensorBase<Device::CPU, T>(base) {}
 
+    // Points to the first element. Views are shifted by their offset.
+
     constexpr const T* data() const noexcept {
-        return reinterpret_cast<T*>(this->buffer->data());
+        return reinterpret_cast<T*>(this->buffer->data()) + this->offset();
     }
 
     constexpr T* data() noexcept {
-        return reinterpret_cast<T*>(this->buffer->data());
+        return reinterpret_cast<T*>(this->buffer->data()) + this->offset();
+    }
+
+    // Copy-on-write clone. The clone reads the memory of this tensor until
+    // `make_writable()` is called while it's shared with other branches.
+    // Modules writing in-place should publish a clone as their output and
+    // call `make_writable()` before each write.
+
+    Result copy_on_write(Tensor& clone) const {
+        if (!this->contiguous()) {
+            JST_ERROR("[CPU:TENSOR] Copy-on-write source must be contiguous.");
+            return Result::ERROR;
+        }
+
+        clone = Tensor(this->shape(), this->buffer, this->offset() * sizeof(T), this->hash());
+
+        return Result::SUCCESS;
+    }
+
+    Result make_writable() {
+        return this->buffer->make_writable();
+    }
+
+    // Swaps the caller memory wrapped by this tensor without touching the
+    // graph. The memory should hold at least `size_bytes()`.
+
+    Result rebind(T* ptr) {
+        if (this->offset() != 0) {
+            JST_ERROR("[CPU:TENSOR] Views cannot be rebound.");
+            return Result::ERROR;
+        }
+
+        return this->buffer->rebind(ptr);
+    }
+
+    // Moves the memory of this tensor into a dense region of `target` (e.g.
+    // a slot of a concatenated output). The tensors sharing this buffer
+    // follow, so a producer writes straight into its consumer.
+
+    Result place(const Tensor& target) {
+        if (this->offset() != 0 || !this->contiguous() || !target.contiguous()) {
+            JST_ERROR("[CPU:TENSOR] Only dense tensors can be placed.");
+            return Result::ERROR;
+        }
+
+        if (this->size() != target.size()) {
+            JST_ERROR("[CPU:TENSOR] Can't place {} into {}.", this->shape(), target.shape());
+            return Result::ERROR;
+        }
+
+        if (this->root_device() != Device::CPU || this->storage->clones.size() != 1) {
+            JST_ERROR("[CPU:TENSOR] Tensors shared with other devices can't be placed.");
+            return Result::ERROR;
+        }
+
+        return this->buffer->place(target.buffer, target.offset() * sizeof(T), this->size_bytes());
     }
 
     constexpr const T& operator[](const U64& idx) const noexcept {
@@ -13,7 +13,8 @@ class TensorBuffer<Device::Vulkan> {
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                           const TensorPrototypeMetadata& prototype,
                           const bool& host_accessible = false,
-                          const VkBufferUsageFlags& usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                          const VkBufferUsageFlags& usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
                                                             VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 
 #ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
@@ -60,10 +61,14 @@ class TensorBuffer<Device::Vulkan> {
     }
 
  private:
-    VkBuffer _buffer;
-    VkDeviceMemory _memory;
+    VkBuffer _buffer = VK_NULL_HANDLE;
+    VkDeviceMemory _memory = VK_NULL_HANDLE;
     bool owns_data = false;
     bool _host_accessible = false;
+
+    void allocate(const TensorPrototypeMetadata& prototype,
+                  const bool& host_accessible,
+                  const VkBufferUsageFlags& usage);
 };
 
 }  // namespace Jetstream
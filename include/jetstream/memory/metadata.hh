@@ -2,6 +2,7 @@
 #define JETSTREAM_MEMORY_METADATA_HH
 
 #include <any>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -66,6 +67,40 @@ struct TensorStorageMetadata {
     std::unordered_set<Device> compatible_devices;
     std::unordered_map<Device, std::any> clones;
 
+    // Clones holding a private copy of the root buffer instead of sharing
+    // its memory. The scheduler keeps them in sync with explicit transfers.
+    std::unordered_set<Device> staged_devices;
+
+    // Storages created with `copy_on_write()` borrow the memory of their
+    // source. They start shared. The scheduler marks them as private when
+    // their writer is the only reader of a source owned by a module of the
+    // graph. A shared storage takes a private copy from the pool on the
+    // first write of a frame and returns it when the next frame starts. A
+    // pinned storage keeps its copy until the graph is destroyed, so
+    // transfers to other devices see a fixed host pointer. The source memory
+    // is looked up on every access because the source can be rebound or
+    // placed after the clone was created.
+    struct CopyOnWrite {
+        U64 source_hash = 0;
+        U64 size_bytes = 0;
+        void* copy = nullptr;
+        bool shared = true;
+        bool pinned = false;
+        bool written = false;
+
+        CopyOnWrite() = default;
+        CopyOnWrite(const CopyOnWrite&) = delete;
+        CopyOnWrite& operator=(const CopyOnWrite&) = delete;
+        ~CopyOnWrite();
+
+        Result write(const void* source);
+        Result pin();
+        void reset();
+        void release();
+    };
+
+    std::shared_ptr<CopyOnWrite> copy_on_write;
+
     struct Attribute {
      public:
         template<typename T>
@@ -98,8 +98,9 @@ class TensorPrototype {
 
     // TODO: Move functions to source file.
 
+    // Index relative to the first element of the tensor (offset excluded).
     U64 shape_to_offset(const std::vector<U64>& shape) const {
-        U64 index = prototype.offset;
+        U64 index = 0;
         U64 pad = shape.size() - prototype.stride.size();
         for (U64 i = 0; i < prototype.stride.size(); i++) {
             // TODO: This is a hack. This should be done by modifiying the stride.
@@ -128,7 +129,40 @@ class TensorPrototype {
         update_cache();
     }
 
-    // TODO: Add permutation() function.
+    // Reorders the axes without moving data. Axis `i` of the result is axis
+    // `axes[i]` of the source, like NumPy's `transpose`.
+    Result permute(const std::vector<U64>& axes) {
+        if (axes.size() != prototype.shape.size()) {
+            JST_ERROR("[MEMORY] Permutation {} doesn't match the rank ({}).", axes, prototype.shape.size());
+            return Result::ERROR;
+        }
+
+        std::vector<bool> seen(axes.size(), false);
+        std::vector<U64> shape(axes.size());
+        std::vector<U64> stride(axes.size());
+
+        for (U64 i = 0; i < axes.size(); i++) {
+            if (axes[i] >= axes.size() || seen[axes[i]]) {
+                JST_ERROR("[MEMORY] Invalid permutation {}.", axes);
+                return Result::ERROR;
+            }
+            seen[axes[i]] = true;
+
+            shape[i] = prototype.shape[axes[i]];
+            stride[i] = prototype.stride[axes[i]];
+        }
+
+        JST_TRACE("[MEMORY] Permute shape: {} -> {}.", prototype.shape, shape);
+        JST_TRACE("[MEMORY] Permute stride: {} -> {}.", prototype.stride, stride);
+
+        prototype.shape = shape;
+        prototype.stride = stride;
+        prototype.contiguous = dense(shape, stride);
+
+        update_cache();
+
+        return Result::SUCCESS;
+    }
 
     Result broadcast_to(const std::vector<U64>& shape) {
         if (shape.size() < prototype.shape.size()) {
@@ -178,6 +212,46 @@ class TensorPrototype {
         return Result::SUCCESS;
     }
 
+    // Reinterprets a contiguous tensor with explicit strides, in elements.
+    // Strides smaller than the inner extent make rows overlap, like NumPy's
+    // `as_strided`. Every element should stay inside the original tensor.
+    Result as_strided(const std::vector<U64>& shape, const std::vector<U64>& stride) {
+        if (!prototype.contiguous) {
+            JST_ERROR("[MEMORY] Strided views need a contiguous source.");
+            return Result::ERROR;
+        }
+
+        if (shape.empty() || shape.size() != stride.size()) {
+            JST_ERROR("[MEMORY] Invalid strided view: shape {} and stride {}.", shape, stride);
+            return Result::ERROR;
+        }
+
+        U64 last = 0;
+        for (U64 i = 0; i < shape.size(); i++) {
+            if (shape[i] == 0) {
+                JST_ERROR("[MEMORY] Strided view shape {} has an empty axis.", shape);
+                return Result::ERROR;
+            }
+            last += (shape[i] - 1) * stride[i];
+        }
+
+        if (last >= prototype.size) {
+            JST_ERROR("[MEMORY] Strided view {} with stride {} exceeds the source size ({}).",
+                      shape, stride, prototype.size);
+            return Result::ERROR;
+        }
+
+        JST_TRACE("[MEMORY] Strided view: {} -> {} with stride {}.", prototype.shape, shape, stride);
+
+        prototype.shape = shape;
+        prototype.stride = stride;
+        prototype.contiguous = dense(shape, stride);
+
+        update_cache();
+
+        return Result::SUCCESS;
+    }
+
     Result view(const std::vector<Token>& tokens) {
         std::vector<U64> shape;
         std::vector<U64> stride;
@@ -218,7 +292,7 @@ class TensorPrototype {
                         throw std::runtime_error("Ellipsis used more than once.");
                     }
                     ellipsis_used = true;
-                    const U64 remaining_dims = prototype.shape.size() - (tokens.size() - 1) + 1;
+                    const U64 remaining_dims = dim + prototype.shape.size() - (tokens.size() - 1);
                     while (dim < remaining_dims) {
                         shape.push_back(prototype.shape[dim]);
                         stride.push_back(prototype.stride[dim]);
@@ -241,10 +315,15 @@ class TensorPrototype {
         JST_TRACE("[MEMORY] View stride: {} -> {}.", prototype.stride, stride);
         JST_TRACE("[MEMORY] View offset: {}.", offset);
 
+        // Dense views still cover a single run of memory, just shifted by the offset.
+        const bool contiguous = dense(shape, stride);
+
+        JST_TRACE("[MEMORY] View contiguous: {} -> {}.", prototype.contiguous, contiguous);
+
         prototype.shape = shape;
         prototype.stride = stride;
-        prototype.offset = offset;
-        prototype.contiguous = false;
+        prototype.offset += offset;
+        prototype.contiguous = contiguous;
 
         update_cache();
 
@@ -254,6 +333,21 @@ class TensorPrototype {
  protected:
     TensorPrototypeMetadata prototype;
 
+    // True when the elements form a single row-major run of memory.
+    static bool dense(const std::vector<U64>& shape, const std::vector<U64>& stride) {
+        U64 expected_stride = 1;
+        for (U64 i = shape.size(); i-- > 0;) {
+            if (shape[i] == 1) {
+                continue;
+            }
+            if (stride[i] != expected_stride) {
+                return false;
+            }
+            expected_stride *= shape[i];
+        }
+        return true;
+    }
+
     void initialize(const std::vector<U64>& shape, const U64& element_size) {
         prototype.shape = shape;
         prototype.element_size = element_size;
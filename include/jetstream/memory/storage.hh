@@ -47,6 +47,14 @@ class TensorStorage : public TensorPrototype {
         return storage->compatible_devices;
     }
 
+    const std::unordered_set<Device>& staged_devices() const noexcept {
+        return storage->staged_devices;
+    }
+
+    const std::shared_ptr<TensorStorageMetadata::CopyOnWrite>& copy_on_write_state() const noexcept {
+        return storage->copy_on_write;
+    }
+
     U64 references() const {
         return storage.use_count();
     }
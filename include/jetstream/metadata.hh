@@ -1,7 +1,7 @@
 #ifndef JETSTREAM_METADATA_HH
 #define JETSTREAM_METADATA_HH
 
-#ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
+#if defined(JETSTREAM_BACKEND_METAL_AVAILABLE) || defined(JETSTREAM_BACKEND_VULKAN_AVAILABLE)
 #include "jetstream/backend/base.hh"
 #endif
 
@@ -31,6 +31,15 @@ struct RuntimeMetadata {
         MTL::CommandBuffer* commandBuffer;
     } metal;
 #endif
+
+#ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
+    struct {
+        VkQueue queue;
+        VkCommandPool commandPool;
+        VkCommandBuffer commandBuffer;
+        VkFence fence;
+    } vulkan;
+#endif
 };
 
 }  // namespace Jetstream
@@ -0,0 +1,194 @@
+#ifndef JETSTREAM_METRICS_HH
+#define JETSTREAM_METRICS_HH
+
+#include <map>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
+#include <chrono>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+// Process-wide registry of counters and gauges. Registration takes a lock,
+// updates are relaxed atomics and can be done from any hot path. Metrics
+// live until the end of the process, references returned are always valid.
+
+class JETSTREAM_API Metrics {
+ public:
+    class Counter {
+     public:
+        void increment(const U64& value = 1) {
+            _value.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        U64 value() const {
+            return _value.load(std::memory_order_relaxed);
+        }
+
+     private:
+        std::atomic<U64> _value{0};
+    };
+
+    class Gauge {
+     public:
+        void set(const F64& value) {
+            _value.store(value, std::memory_order_relaxed);
+        }
+
+        F64 value() const {
+            return _value.load(std::memory_order_relaxed);
+        }
+
+     private:
+        std::atomic<F64> _value{0.0};
+    };
+
+    // Exponential buckets from 50 us to ~6.5 s. Values are in seconds.
+    class Histogram {
+     public:
+        static constexpr U64 BucketCount = 18;
+
+        static constexpr F64 Bound(const U64& index) {
+            return 50e-6 * static_cast<F64>(1ULL << index);
+        }
+
+        void observe(const F64& value) {
+            U64 index = 0;
+            while (index < BucketCount && value > Bound(index)) {
+                index += 1;
+            }
+            buckets[index].fetch_add(1, std::memory_order_relaxed);
+            _sum.fetch_add(value, std::memory_order_relaxed);
+            _count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        U64 bucket(const U64& index) const {
+            return buckets[index].load(std::memory_order_relaxed);
+        }
+
+        U64 count() const {
+            return _count.load(std::memory_order_relaxed);
+        }
+
+        F64 sum() const {
+            return _sum.load(std::memory_order_relaxed);
+        }
+
+        // Upper bound of the bucket containing the quantile.
+        F64 quantile(const F64& q) const {
+            const U64 total = count();
+            if (total == 0) {
+                return 0.0;
+            }
+
+            U64 accumulated = 0;
+            for (U64 i = 0; i < BucketCount; i++) {
+                accumulated += bucket(i);
+                if (accumulated >= q * total) {
+                    return Bound(i);
+                }
+            }
+            return Bound(BucketCount - 1);
+        }
+
+     private:
+        std::array<std::atomic<U64>, BucketCount + 1> buckets{};
+        std::atomic<F64> _sum{0.0};
+        std::atomic<U64> _count{0};
+    };
+
+    // Labels are in the Prometheus format without braces (e.g. `block="soapy"`).
+
+    static Counter& GetCounter(const std::string& name,
+                               const std::string& help,
+                               const std::string& labels = "") {
+        return getInstance().getCounter(name, help, labels);
+    }
+
+    static Gauge& GetGauge(const std::string& name,
+                           const std::string& help,
+                           const std::string& labels = "") {
+        return getInstance().getGauge(name, help, labels);
+    }
+
+    static Histogram& GetHistogram(const std::string& name,
+                                   const std::string& help,
+                                   const std::string& labels = "") {
+        return getInstance().getHistogram(name, help, labels);
+    }
+
+    static std::string RenderPrometheus() {
+        return getInstance().renderPrometheus();
+    }
+
+    static std::string RenderJson() {
+        return getInstance().renderJson();
+    }
+
+    // Serves the Prometheus text format over HTTP. The endpoint can be a
+    // TCP address (`127.0.0.1:9464`) or a Unix socket (`unix:/tmp/jetstream.sock`).
+    static Result StartExporter(const std::string& endpoint) {
+        return getInstance().startExporter(endpoint);
+    }
+
+    // Periodically writes a JSON snapshot of every metric to a file.
+    static Result StartDump(const std::string& path,
+                            const std::chrono::milliseconds& interval = std::chrono::seconds(5)) {
+        return getInstance().startDump(path, interval);
+    }
+
+    static Result Stop() {
+        return getInstance().stop();
+    }
+
+ private:
+    enum class Type : U8 {
+        Counter,
+        Gauge,
+        Histogram,
+    };
+
+    struct Family {
+        std::string help;
+        Type type;
+        std::map<std::string, std::unique_ptr<Counter>> counters;
+        std::map<std::string, std::unique_ptr<Gauge>> gauges;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    static Metrics& getInstance();
+
+    ~Metrics();
+
+    std::mutex registryMutex;
+    std::map<std::string, Family> families;
+
+    std::atomic_bool running{false};
+    std::thread exporterThread;
+    std::thread dumpThread;
+    I32 exporterFd = -1;
+    std::string exporterPath;
+
+    Counter& getCounter(const std::string& name, const std::string& help, const std::string& labels);
+    Gauge& getGauge(const std::string& name, const std::string& help, const std::string& labels);
+    Histogram& getHistogram(const std::string& name, const std::string& help, const std::string& labels);
+    Family& getFamily(const std::string& name, const std::string& help, const Type& type);
+
+    std::string renderPrometheus();
+    std::string renderJson();
+
+    Result startExporter(const std::string& endpoint);
+    Result startDump(const std::string& path, const std::chrono::milliseconds& interval);
+    Result stop();
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -5,6 +5,7 @@
 #include "jetstream/macros.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/metadata.hh"
+#include "jetstream/latency.hh"
 #include "jetstream/benchmark.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/memory/base.hh"
@@ -99,6 +100,26 @@ class JETSTREAM_API Compute {
         return Result::SUCCESS;
     }
 
+    // Source modules return the capture time of the samples
+    // produced by the last compute. Other modules return zero.
+    virtual Latency::Timestamp captureTimestamp() const {
+        return {};
+    }
+
+    // Modules publishing views of their inputs return true. Their outputs
+    // alias the input memory and are never written by the module.
+    virtual bool outputsAliasInputs() const {
+        return false;
+    }
+
+    // Modules gathering inputs into one output (e.g. Concat) can move the
+    // listed inputs into their slot of the output, so the producers write
+    // there directly. Placed inputs are returned with their new address.
+    virtual Result placeInputs(const std::unordered_set<std::string>&,
+                               std::unordered_map<std::string, void*>&) {
+        return Result::SUCCESS;
+    }
+
  protected:
     friend Instance;
 };
@@ -115,6 +136,13 @@ class JETSTREAM_API Present {
         return Result::SUCCESS;
     }
 
+    // Display modules accumulate every computed frame inside `compute()` and
+    // build the displayed data here. Called by the scheduler before `present()`
+    // only when new frames were computed since the last call.
+    virtual constexpr Result finalize() {
+        return Result::SUCCESS;
+    }
+
  protected:
     std::shared_ptr<Render::Window> window;
 
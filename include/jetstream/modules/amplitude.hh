@@ -7,6 +7,10 @@
 #include "jetstream/memory/base.hh"
 #include "jetstream/compute/graph/base.hh"
 
+#ifdef JETSTREAM_MODULE_AMPLITUDE_CPU_AVAILABLE
+#include "jetstream/backend/devices/cpu/math.hh"
+#endif
+
 namespace Jetstream {
 
 #define JST_AMPLITUDE_CPU(MACRO) \
@@ -15,13 +19,20 @@ namespace Jetstream {
 #define JST_AMPLITUDE_METAL(MACRO) \
     MACRO(Amplitude, Metal, CF32, F32)
 
+#define JST_AMPLITUDE_VULKAN(MACRO) \
+    MACRO(Amplitude, Vulkan, CF32, F32)
+
 template<Device D, typename IT = CF32, typename OT = F32>
 class Amplitude : public Module, public Compute {
  public:
     // Configuration 
 
+    // Accuracy of the logarithm on the CPU: "fast", "balanced" or "exact".
+
     struct Config {
-        JST_SERDES();
+        std::string accuracy = "fast";
+
+        JST_SERDES(accuracy);
     };
 
     constexpr const Config& getConfig() const {
@@ -70,6 +81,7 @@ class Amplitude : public Module, public Compute {
 
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
 
  private:
@@ -84,6 +96,25 @@ class Amplitude : public Module, public Compute {
     } metal;
 #endif
 
+#ifdef JETSTREAM_MODULE_AMPLITUDE_VULKAN_AVAILABLE
+    struct VulkanConstants {
+        U32 size;
+        U32 offset;
+        F32 scalingSize;
+    };
+
+    struct {
+        Vulkan::Kernel kernel;
+        VulkanConstants constants;
+    } vulkan;
+#endif
+
+#ifdef JETSTREAM_MODULE_AMPLITUDE_CPU_AVAILABLE
+    struct {
+        Backend::MathAccuracy accuracy;
+    } cpu;
+#endif
+
     U64 scalingSize = 0;
 
     JST_DEFINE_IO();
@@ -95,6 +126,9 @@ JST_AMPLITUDE_CPU(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_AMPLITUDE_METAL_AVAILABLE
 JST_AMPLITUDE_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_AMPLITUDE_VULKAN_AVAILABLE
+JST_AMPLITUDE_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
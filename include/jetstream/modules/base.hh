@@ -88,6 +88,7 @@
 #endif
 
 #include "jetstream/modules/tensor_modifier.hh"
+#include "jetstream/modules/fused.hh"
 
 #ifdef JETSTREAM_MODULE_FOLD_AVAILABLE
 #include "jetstream/modules/fold.hh"
@@ -101,6 +102,38 @@
 #include "jetstream/modules/take.hh"
 #endif
 
+#ifdef JETSTREAM_MODULE_SLICE_AVAILABLE
+#include "jetstream/modules/slice.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CALLBACK_SINK_AVAILABLE
+#include "jetstream/modules/callback_sink.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_FRAME_AVAILABLE
+#include "jetstream/modules/frame.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_TRANSPOSE_AVAILABLE
+#include "jetstream/modules/transpose.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CONCAT_AVAILABLE
+#include "jetstream/modules/concat.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_TONE_BANK_AVAILABLE
+#include "jetstream/modules/tone_bank.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CFAR_AVAILABLE
+#include "jetstream/modules/cfar.hh"
+#endif
+
+#ifdef JETSTREAM_MODULE_CIC_AVAILABLE
+#include "jetstream/modules/cic.hh"
+#endif
+
 // [NEW MODULE HOOK]
 
 #endif  // JETSTREAM_MODULES_BASE_HH
@@ -0,0 +1,134 @@
+#ifndef JETSTREAM_MODULES_CALLBACK_SINK_HH
+#define JETSTREAM_MODULES_CALLBACK_SINK_HH
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/metrics.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CALLBACK_SINK_CPU(MACRO) \
+    MACRO(CallbackSink, CPU, CF32) \
+    MACRO(CallbackSink, CPU, F32)
+
+// Delivers the input to user code once per frame, after it was computed.
+//
+// By default the callback runs on the compute thread with a read-only view
+// of the input. It should return quickly. With `dispatch` enabled, each
+// frame is copied into one of `queueDepth` slots and the callback runs on a
+// dispatcher thread. When every slot is taken, the "drop" policy skips the
+// frame and the "block" policy waits for the dispatcher.
+//
+// Callbacks can be passed in the configuration or registered by name, which
+// lets blocks loaded from a flowgraph file find them.
+
+template<Device D, typename T = CF32>
+class CallbackSink : public Module, public Compute {
+ public:
+    using Callback = std::function<void(const Tensor<D, T>&)>;
+
+    // Configuration
+
+    struct Config {
+        std::string name = "";
+        bool dispatch = false;
+        U64 queueDepth = 4;
+        std::string policy = "drop";
+        Callback callback;
+
+        JST_SERDES(name, dispatch, queueDepth, policy);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        JST_SERDES_OUTPUT();
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+    // Miscellaneous
+
+    U64 droppedFrames() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    static Result RegisterCallback(const std::string& name, const Callback& callback);
+    static Result RemoveCallback(const std::string& name);
+
+ protected:
+    Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    Callback callback;
+    bool blocking = false;
+
+    // Single producer (compute) and single consumer (dispatcher) ring.
+    // The mutex only guards the wake-ups, never the callback.
+
+    std::vector<Tensor<D, T>> slots;
+    alignas(64) std::atomic<U64> head{0};
+    alignas(64) std::atomic<U64> tail{0};
+    std::atomic<U64> dropped{0};
+
+    std::thread dispatcher;
+    std::mutex mutex;
+    std::condition_variable produced;
+    std::condition_variable consumed;
+    bool running = false;
+
+    Metrics::Counter* droppedCounter = nullptr;
+
+    void dispatcherLoop();
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_CALLBACK_SINK_CPU_AVAILABLE
+JST_CALLBACK_SINK_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef JETSTREAM_MODULES_CFAR_HH
+#define JETSTREAM_MODULES_CFAR_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CFAR_CPU(MACRO) \
+    MACRO(CFAR, CPU, F32)
+
+// Constant false alarm rate detector for {bins} or {batch, bins} spectra in
+// dB (e.g. the Amplitude output). The noise around each bin is estimated
+// from `training` cells on each side, skipping `guard` cells next to it.
+// The "ca" mode averages their linear power and the "os" mode takes the
+// `rank` quantile.
+// Bins more than `threshold` dB above their noise are detected. Each run of
+// adjacent detected bins is reported once, at its strongest bin.
+//
+// Detections are written as {maxDetections, 3} (or {batch, maxDetections,
+// 3}) rows of (bin, power, SNR), sorted by bin. Runs past `maxDetections`
+// are dropped. The rows after the last detection are padded with bin -1 and
+// zero power and SNR. The number of valid rows of each batch is published
+// as a {batch} count ({1} for a {bins} input), so readers don't have to
+// scan for the padding.
+
+template<Device D, typename T = F32>
+class CFAR : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        std::string mode = "ca";
+        U64 training = 16;
+        U64 guard = 2;
+        F32 threshold = 10.0f;
+        F32 rank = 0.75f;
+        U64 maxDetections = 64;
+
+        JST_SERDES(mode, training, guard, threshold, rank, maxDetections);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> detections;
+        Tensor<D, U64> count;
+
+        JST_SERDES_OUTPUT(detections, count);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputDetections() const {
+        return this->output.detections;
+    }
+
+    constexpr const Tensor<D, U64>& getOutputCount() const {
+        return this->output.count;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    U64 numberOfBatches = 0;
+    U64 numberOfBins = 0;
+    bool orderedStatistic = false;
+
+#ifdef JETSTREAM_MODULE_CFAR_CPU_AVAILABLE
+    struct {
+        std::vector<F64> prefix;
+        std::vector<F32> noise;
+        std::vector<F32> cells;
+    } cpu;
+#endif
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_CFAR_CPU_AVAILABLE
+JST_CFAR_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
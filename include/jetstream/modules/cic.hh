@@ -0,0 +1,132 @@
+#ifndef JETSTREAM_MODULES_CIC_HH
+#define JETSTREAM_MODULES_CIC_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CIC_CPU(MACRO) \
+    MACRO(CIC, CPU, CF32)
+
+// Cascaded integrator-comb decimator for {samples} or {batch, samples}
+// streams. It decimates by `decimation` with `stages` integrator and comb
+// pairs, each comb with a differential `delay`, and its gain is normalized
+// to one. The state is kept across frames, so it can sit first in a
+// down-conversion chain, after the mixer and before narrower filters. The
+// input is clamped to a full scale of one in both modes.
+//
+// The integer mode runs the usual recursive structure on wrapping 64-bit
+// integers. The input is quantized to the bits left after the register
+// growth. It costs `stages` additions per input
+// sample and `stages` subtractions per output sample, whatever the
+// decimation. The float mode computes the same response as a FIR at the
+// output rate, which costs `stages` · `delay` products per input sample.
+// Float integrators aren't used because their rounding error grows without
+// bound.
+//
+// An optional compensation FIR with `compensationTaps` taps flattens the
+// droop of the response up to `passband` (as a fraction of the output
+// sample rate). Channels are processed side by side so the inner loops
+// vectorize across them.
+
+template<Device D, typename T = CF32>
+class CIC : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        U64 decimation = 64;
+        U64 stages = 4;
+        U64 delay = 1;
+        bool integer = true;
+        U64 compensationTaps = 0;
+        F32 passband = 0.25f;
+
+        JST_SERDES(decimation, stages, delay, integer, compensationTaps, passband);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    U64 numberOfChannels = 0;
+    U64 numberOfSamples = 0;
+    U64 registerGrowth = 0;
+
+#ifdef JETSTREAM_MODULE_CIC_CPU_AVAILABLE
+    struct {
+        std::vector<CF32> history;
+        std::vector<CF32> decimated;
+        std::vector<CF32> compensated;
+        std::vector<U64> integrators;
+        std::vector<U64> combs;
+        std::vector<U64> stage;
+        std::vector<F32> response;
+        std::vector<F32> compensation;
+        U64 historyCarry = 0;
+        U64 decimatedCarry = 0;
+        U64 cursor = 0;
+        F64 quantization = 0.0;
+    } cpu;
+#endif
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_CIC_CPU_AVAILABLE
+JST_CIC_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef JETSTREAM_MODULES_CONCAT_HH
+#define JETSTREAM_MODULES_CONCAT_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_CONCAT_CPU(MACRO) \
+    MACRO(Concat, CPU, CF32) \
+    MACRO(Concat, CPU, F32)
+
+// Joins two tensors along `axis`. With `stack` the inputs have the same
+// shape and are joined along a new axis inserted at `axis`. Each input is a
+// slot of the output. The scheduler moves dense slots into the output
+// memory so the producers write there and nothing is copied. The other
+// slots are copied every frame.
+
+template<Device D, typename T = CF32>
+class Concat : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        U64 axis = 0;
+        bool stack = false;
+
+        JST_SERDES(axis, stack);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> bufferA;
+        Tensor<D, T> bufferB;
+
+        JST_SERDES_INPUT(bufferA, bufferB);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    Result placeInputs(const std::unordered_set<std::string>& inputs,
+                       std::unordered_map<std::string, void*>& addresses) final;
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    Tensor<D, T> slotA;
+    Tensor<D, T> slotB;
+    bool placedA = false;
+    bool placedB = false;
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_CONCAT_CPU_AVAILABLE
+JST_CONCAT_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
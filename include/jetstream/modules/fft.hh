@@ -22,6 +22,14 @@
 #define VKFFT_BACKEND 5
 #include "jetstream/tools/vkFFT.h"
 #pragma GCC diagnostic pop
+#elif defined(JETSTREAM_MODULE_FFT_VULKAN_AVAILABLE)
+#pragma GCC diagnostic push 
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#define VKFFT_BACKEND 0
+#include "jetstream/tools/vkFFT.h"
+#pragma GCC diagnostic pop
 #endif
 
 namespace Jetstream {
@@ -32,15 +40,22 @@ namespace Jetstream {
 #define JST_FFT_METAL(MACRO) \
     MACRO(FFT, Metal, CF32)
 
+#define JST_FFT_VULKAN(MACRO) \
+    MACRO(FFT, Vulkan, CF32)
+
 template<Device D, typename T = CF32>
 class FFT : public Module, public Compute {
  public:
     // Configuration 
 
+    // Axes to transform. Empty transforms the last axis. Only the CPU
+    // accepts other axes.
+
     struct Config {
         bool forward = true;
+        std::vector<U64> axes = {};
 
-        JST_SERDES(forward);
+        JST_SERDES(forward, axes);
     };
 
     constexpr const Config& getConfig() const {
@@ -87,6 +102,19 @@ class FFT : public Module, public Compute {
 
     Result create();
 
+    // Benchmark
+
+    F64 benchmark_flops() const {
+        // Radix-2 estimate of 5·N·log2(N) per transform along each axis.
+        F64 flops = 0.0;
+        for (const auto& axis : axes) {
+            const F64 length = static_cast<F64>(input.buffer.shape()[axis]);
+            const F64 batches = static_cast<F64>(input.buffer.size()) / length;
+            flops += 5.0 * length * std::log2(length) * batches;
+        }
+        return flops;
+    }
+
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
     Result destroyCompute(const RuntimeMetadata& meta) final;
@@ -96,8 +124,10 @@ class FFT : public Module, public Compute {
 #ifdef JETSTREAM_MODULE_FFT_CPU_AVAILABLE
     struct {
         pocketfft::shape_t shape;
-        pocketfft::stride_t stride;
-        pocketfft::shape_t axes;
+        pocketfft::stride_t inputStride;
+        pocketfft::stride_t outputStride;
+        std::vector<bool> transposed;
+        Tensor<Device::CPU, T> scratch;
     } cpu;
 #endif
 
@@ -110,6 +140,19 @@ class FFT : public Module, public Compute {
     } metal;
 #endif
 
+#ifdef JETSTREAM_MODULE_FFT_VULKAN_AVAILABLE
+    struct {
+        VkFFTApplication* app;
+        VkFFTConfiguration* configuration;
+        VkBuffer input;
+        VkBuffer output;
+        U64 inputSize;
+        U64 outputSize;
+        VkCommandBuffer commandBuffer;
+    } vulkan;
+#endif
+
+    std::vector<U64> axes;
     U64 numberOfOperations = 0;
     U64 numberOfElements = 0;
     U64 elementStride = 0;
@@ -123,6 +166,9 @@ JST_FFT_CPU(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_FFT_METAL_AVAILABLE
 JST_FFT_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_FFT_VULKAN_AVAILABLE
+JST_FFT_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -8,6 +8,10 @@
 #include "jetstream/memory/base.hh"
 #include "jetstream/compute/graph/base.hh"
 
+#ifdef JETSTREAM_MODULE_FM_CPU_AVAILABLE
+#include "jetstream/backend/devices/cpu/math.hh"
+#endif
+
 namespace Jetstream {
 
 #define JST_FM_CPU(MACRO) \
@@ -18,10 +22,13 @@ class FM : public Module, public Compute {
  public:
     // Configuration 
 
+    // Accuracy of the phase detector: "fast", "balanced" or "exact".
+
     struct Config {
         F32 sampleRate = 240e3f;
+        std::string accuracy = "exact";
 
-        JST_SERDES(sampleRate);
+        JST_SERDES(sampleRate, accuracy);
     };
 
     constexpr const Config& getConfig() const {
@@ -76,6 +83,12 @@ class FM : public Module, public Compute {
     F32 kf;
     F32 ref;
 
+#ifdef JETSTREAM_MODULE_FM_CPU_AVAILABLE
+    struct {
+        Backend::MathAccuracy accuracy;
+    } cpu;
+#endif
+
     JST_DEFINE_IO();
 };
 
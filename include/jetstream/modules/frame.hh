@@ -0,0 +1,98 @@
+#ifndef JETSTREAM_MODULES_FRAME_HH
+#define JETSTREAM_MODULES_FRAME_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_FRAME_CPU(MACRO) \
+    MACRO(Frame, CPU, CF32) \
+    MACRO(Frame, CPU, F32)
+
+// Splits a {samples} or {batch, samples} stream into {frames, frameSize}
+// frames starting every `hop` samples. The output is a strided view. When
+// frames don't overlap it's a view of the input. Otherwise the last
+// `frameSize - hop` samples of the previous input are carried over in front
+// of the current one, and the frames are a view of that history buffer.
+
+template<Device D, typename T = CF32>
+class Frame : public Module, public Compute {
+ public:
+    // Configuration
+
+    struct Config {
+        U64 frameSize = 1024;
+        U64 hop = 512;
+
+        JST_SERDES(frameSize, hop);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    bool outputsAliasInputs() const final {
+        return carry == 0;
+    }
+
+    // Constructor
+
+    Result create();
+
+ protected:
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    Tensor<D, T> history;
+    U64 carry = 0;
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_FRAME_CPU_AVAILABLE
+JST_FRAME_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
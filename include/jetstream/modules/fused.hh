@@ -0,0 +1,349 @@
+#ifndef JETSTREAM_MODULES_FUSED_HH
+#define JETSTREAM_MODULES_FUSED_HH
+
+#include <utility>
+#include <concepts>
+#include <type_traits>
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+#include "jetstream/backend/devices/cpu/math.hh"
+
+namespace Jetstream {
+
+// Elementwise stages composed at compile time. A chain built with `|` is a
+// single type whose call operator inlines every stage, so the whole chain
+// runs as one loop without intermediate tensors.
+//
+//     auto pipeline = Elementwise::Amplitude() | Elementwise::Scale({-100.0f, 0.0f});
+//     JST_CHECK(Elementwise::Run(pipeline, spectrum, output));
+//
+// A chain can also be placed in the flowgraph with the `Fused` module.
+//
+// Stages receive each element with its index along the last axis. Before
+// running, `create()` is called once with the size of that axis. Stages are
+// default constructible so a chain can be held by a module configuration.
+
+namespace Elementwise {
+
+template<typename S>
+concept Stage = requires(S& stage,
+                         const typename S::InputType& x,
+                         const U64& column) {
+    typename S::InputType;
+    typename S::OutputType;
+    { stage.create(column) } -> std::same_as<Result>;
+    { std::as_const(stage)(x, column) } -> std::same_as<typename S::OutputType>;
+};
+
+template<Stage A, Stage B>
+class Chain {
+ public:
+    static_assert(std::is_same_v<typename A::OutputType, typename B::InputType>,
+                  "Output type of a stage should match the input type of the next.");
+
+    using InputType = typename A::InputType;
+    using OutputType = typename B::OutputType;
+
+    Chain() = default;
+    Chain(const A& first, const B& second) : first(first), second(second) {}
+
+    Result create(const U64& columns) {
+        JST_CHECK(first.create(columns));
+        JST_CHECK(second.create(columns));
+        return Result::SUCCESS;
+    }
+
+    inline OutputType operator()(const InputType& x, const U64& column) const {
+        return second(first(x, column), column);
+    }
+
+ private:
+    A first;
+    B second;
+};
+
+template<Stage A, Stage B>
+inline Chain<A, B> operator|(const A& first, const B& second) {
+    return Chain<A, B>(first, second);
+}
+
+// Product with a factor spanning the last axis, like a window.
+
+template<typename T>
+class Multiply {
+ public:
+    using InputType = T;
+    using OutputType = T;
+
+    Multiply() = default;
+    Multiply(const Tensor<Device::CPU, T>& factor) : factor(factor) {}
+
+    Result create(const U64& columns) {
+        if (!factor.contiguous() || factor.size() != columns) {
+            JST_ERROR("[ELEMENTWISE] Multiply factor {} should be contiguous and "
+                      "match the last axis ({}).", factor.shape(), columns);
+            return Result::ERROR;
+        }
+        data = factor.data();
+        return Result::SUCCESS;
+    }
+
+    inline T operator()(const T& x, const U64& column) const {
+        const T& y = data[column];
+        if constexpr (std::is_same_v<T, CF32>) {
+            return CF32(x.real() * y.real() - x.imag() * y.imag(),
+                        x.real() * y.imag() + x.imag() * y.real());
+        } else {
+            return x * y;
+        }
+    }
+
+ private:
+    Tensor<Device::CPU, T> factor;
+    const T* data = nullptr;
+};
+
+template<typename T>
+class MultiplyConstant {
+ public:
+    using InputType = T;
+    using OutputType = T;
+
+    MultiplyConstant(const T& constant = T(1)) : constant(constant) {}
+
+    Result create(const U64&) {
+        return Result::SUCCESS;
+    }
+
+    inline T operator()(const T& x, const U64&) const {
+        return x * constant;
+    }
+
+ private:
+    T constant;
+};
+
+// Same output as the Amplitude module: 20 * log10(|x| / N).
+
+template<Backend::MathAccuracy A = Backend::MathAccuracy::Fast>
+class Amplitude {
+ public:
+    using InputType = CF32;
+    using OutputType = F32;
+
+    Result create(const U64& columns) {
+        offset = 20.0f * std::log10(static_cast<F32>(columns));
+        return Result::SUCCESS;
+    }
+
+    inline F32 operator()(const CF32& x, const U64&) const {
+        const F32 power = x.real() * x.real() + x.imag() * x.imag();
+        return 10.0f * Backend::Log10<A>(power) - offset;
+    }
+
+ private:
+    F32 offset = 0.0f;
+};
+
+class Scale {
+ public:
+    using InputType = F32;
+    using OutputType = F32;
+
+    Scale(const Range<F32>& range = {-1.0f, +1.0f}) : range(range) {}
+
+    Result create(const U64&) {
+        return Result::SUCCESS;
+    }
+
+    inline F32 operator()(const F32& x, const U64&) const {
+        return (x - range.min) / (range.max - range.min);
+    }
+
+ private:
+    Range<F32> range;
+};
+
+// User defined stage. The callable is inlined like the built-in stages.
+
+template<typename I, typename O, typename F>
+class Map {
+ public:
+    using InputType = I;
+    using OutputType = O;
+
+    Map() = default;
+    Map(const F& function) : function(function) {}
+
+    Result create(const U64&) {
+        return Result::SUCCESS;
+    }
+
+    inline O operator()(const I& x, const U64&) const {
+        return function(x);
+    }
+
+ private:
+    F function;
+};
+
+template<typename I, typename O, typename F>
+inline Map<I, O, F> MakeMap(const F& function) {
+    return Map<I, O, F>(function);
+}
+
+template<Stage P>
+Result Validate(const Tensor<Device::CPU, typename P::InputType>& input,
+                const Tensor<Device::CPU, typename P::OutputType>& output) {
+    if (input.empty() || input.shape() != output.shape()) {
+        JST_ERROR("[ELEMENTWISE] Input {} and output {} should have the same shape.",
+                  input.shape(), output.shape());
+        return Result::ERROR;
+    }
+
+    if (!input.contiguous() || !output.contiguous()) {
+        JST_ERROR("[ELEMENTWISE] Input and output should be contiguous.");
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+// Expects a created pipeline and tensors checked by `Validate()`.
+
+template<Stage P>
+inline void Execute(const P& pipeline,
+                    const Tensor<Device::CPU, typename P::InputType>& input,
+                    Tensor<Device::CPU, typename P::OutputType>& output) {
+    const U64 columns = input.shape()[input.rank() - 1];
+    const U64 rows = input.size() / columns;
+    const auto* in = input.data();
+    auto* out = output.data();
+
+    for (U64 r = 0; r < rows; r++) {
+        const auto* x = in + r * columns;
+        auto* y = out + r * columns;
+
+        for (U64 c = 0; c < columns; c++) {
+            y[c] = pipeline(x[c], c);
+        }
+    }
+}
+
+template<Stage P>
+Result Run(P& pipeline,
+           const Tensor<Device::CPU, typename P::InputType>& input,
+           Tensor<Device::CPU, typename P::OutputType>& output) {
+    JST_CHECK(Validate<P>(input, output));
+    JST_CHECK(pipeline.create(input.shape()[input.rank() - 1]));
+    Execute(pipeline, input, output);
+    return Result::SUCCESS;
+}
+
+}  // namespace Elementwise
+
+// Runs an elementwise chain as a single module of the flowgraph.
+//
+//     auto post = Elementwise::Amplitude() | Elementwise::Scale({-100.0f, 0.0f});
+//     instance.addModule<Fused, Device::CPU, decltype(post)>(
+//         fused, "fused", { .pipeline = post }, { .buffer = fft->getOutputBuffer() });
+
+template<Device D, typename P>
+class Fused : public Module, public Compute {
+ public:
+    static_assert(D == Device::CPU, "Fused pipelines are only available on the CPU.");
+    static_assert(Elementwise::Stage<P>, "Pipeline should be an elementwise stage or chain.");
+
+    using IT = typename P::InputType;
+    using OT = typename P::OutputType;
+
+    // Configuration
+
+    struct Config {
+        P pipeline;
+
+        JST_SERDES();
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, IT> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, OT> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, OT>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final {
+        JST_INFO("  Input Shape: {}", input.buffer.shape());
+    }
+
+    // Constructor
+
+    Result create() {
+        JST_DEBUG("Initializing Fused module.");
+        JST_INIT_IO();
+
+        // Allocate output.
+
+        output.buffer = Tensor<D, OT>(input.buffer.shape());
+
+        JST_CHECK(Elementwise::Validate<P>(input.buffer, output.buffer));
+
+        return Result::SUCCESS;
+    }
+
+ protected:
+    Result createCompute(const RuntimeMetadata&) final {
+        JST_TRACE("Create Fused compute core using CPU backend.");
+
+        JST_CHECK(config.pipeline.create(input.buffer.shape()[input.buffer.rank() - 1]));
+
+        return Result::SUCCESS;
+    }
+
+    Result compute(const RuntimeMetadata&) final {
+        Elementwise::Execute(config.pipeline, input.buffer, output.buffer);
+        return Result::SUCCESS;
+    }
+
+ private:
+    JST_DEFINE_IO();
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -78,12 +78,18 @@ class Lineplot : public Module, public Compute, public Present {
 
     Render::Texture& getTexture();
 
+    // Displayed {elements, 3} vertices, built by the last finalize.
+    constexpr const Tensor<Device::CPU, F32>& getPlot() const {
+        return plot;
+    }
+
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
 
     Result createPresent() final;
     Result present() final;
+    Result finalize() final;
     Result destroyPresent() final;
 
  private:
@@ -107,6 +113,13 @@ class Lineplot : public Module, public Compute, public Present {
     std::shared_ptr<Render::Draw> drawGridVertex;
     std::shared_ptr<Render::Draw> drawLineVertex;
 
+#ifdef JETSTREAM_MODULE_LINEPLOT_CPU_AVAILABLE
+    struct {
+        std::vector<F32> sums;
+        U64 batches = 0;
+    } cpu;
+#endif
+
 #ifdef JETSTREAM_MODULE_LINEPLOT_METAL_AVAILABLE
     struct MetalConstants {
         U16 batchSize;
@@ -17,6 +17,10 @@ namespace Jetstream {
 #define JST_MULTIPLY_METAL(MACRO) \
     MACRO(Multiply, Metal, CF32)
 
+#define JST_MULTIPLY_VULKAN(MACRO) \
+    MACRO(Multiply, Vulkan, CF32) \
+    MACRO(Multiply, Vulkan, F32)
+
 template<Device D, typename T = CF32>
 class Multiply : public Module, public Compute {
  public:
@@ -71,8 +75,17 @@ class Multiply : public Module, public Compute {
 
     Result create();
 
+    // Benchmark
+
+    F64 benchmark_flops() const {
+        // A complex product takes four multiplications and two additions.
+        const F64 flopsPerElement = (std::is_same_v<T, CF32>) ? 6.0 : 1.0;
+        return flopsPerElement * static_cast<F64>(output.product.size());
+    }
+
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
 
  private:
@@ -80,12 +93,35 @@ class Multiply : public Module, public Compute {
     Tensor<D, T> b;
     Tensor<D, T> c;
 
+#ifdef JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE
+    struct {
+        void (*kernel)(const T*, const T*, T*, const U64&) = nullptr;
+    } cpu;
+#endif
+
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
     struct {
         MTL::ComputePipelineState* state;
     } metal;
 #endif
 
+#ifdef JETSTREAM_MODULE_MULTIPLY_VULKAN_AVAILABLE
+    struct VulkanConstants {
+        U32 size;
+        U32 rank;
+        U32 offsetA;
+        U32 offsetB;
+        U32 shape[4];
+        U32 strideA[4];
+        U32 strideB[4];
+    };
+
+    struct {
+        Vulkan::Kernel kernel;
+        VulkanConstants constants;
+    } vulkan;
+#endif
+
     JST_DEFINE_IO();
 };
 
@@ -95,6 +131,9 @@ JST_MULTIPLY_CPU(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
 JST_MULTIPLY_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_MULTIPLY_VULKAN_AVAILABLE
+JST_MULTIPLY_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
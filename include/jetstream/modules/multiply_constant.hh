@@ -73,6 +73,13 @@ class MultiplyConstant : public Module, public Compute {
 
     Result create();
 
+    // Benchmark
+
+    F64 benchmark_flops() const {
+        const F64 flopsPerElement = (std::is_same_v<T, CF32>) ? 6.0 : 1.0;
+        return flopsPerElement * static_cast<F64>(output.product.size());
+    }
+
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
@@ -16,6 +16,9 @@ namespace Jetstream {
 #define JST_SCALE_METAL(MACRO) \
     MACRO(Scale, Metal, F32)
 
+#define JST_SCALE_VULKAN(MACRO) \
+    MACRO(Scale, Vulkan, F32)
+
 template<Device D, typename T = F32>
 class Scale : public Module, public Compute {
  public:
@@ -84,6 +87,7 @@ class Scale : public Module, public Compute {
 
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
 
  private:
@@ -99,6 +103,19 @@ class Scale : public Module, public Compute {
     } metal;
 #endif
 
+#ifdef JETSTREAM_MODULE_SCALE_VULKAN_AVAILABLE
+    struct VulkanConstants {
+        U32 size;
+        U32 offset;
+        F32 min;
+        F32 max;
+    };
+
+    struct {
+        Vulkan::Kernel kernel;
+    } vulkan;
+#endif
+
     JST_DEFINE_IO();
 };
 
@@ -108,6 +125,9 @@ JST_SCALE_CPU(JST_SPECIALIZATION);
 #ifdef JETSTREAM_MODULE_SCALE_METAL_AVAILABLE
 JST_SCALE_METAL(JST_SPECIALIZATION);
 #endif
+#ifdef JETSTREAM_MODULE_SCALE_VULKAN_AVAILABLE
+JST_SCALE_VULKAN(JST_SPECIALIZATION);
+#endif
 
 }  // namespace Jetstream
 
@@ -0,0 +1,95 @@
+#ifndef JETSTREAM_MODULES_SLICE_HH
+#define JETSTREAM_MODULES_SLICE_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_SLICE_CPU(MACRO) \
+    MACRO(Slice, CPU, CF32) \
+    MACRO(Slice, CPU, F32)
+
+template<Device D, typename T = CF32>
+class Slice : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        std::string slice = "[...]";
+
+        JST_SERDES(slice);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    bool outputsAliasInputs() const final {
+        return aliased;
+    }
+
+    // Constructor
+
+    Result create();
+
+    // Parses a NumPy-like slice ("[0, 1:8:2, ...]") into view tokens.
+
+    static Result ParseTokens(const std::string& slice, std::vector<Token>& tokens);
+
+ protected:
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    Tensor<D, T> view;
+    bool aliased = false;
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_SLICE_CPU_AVAILABLE
+JST_SLICE_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -127,6 +127,10 @@ class Soapy : public Module, public Compute {
     Result compute(const RuntimeMetadata& meta) final;
     Result computeReady() final;
 
+    Latency::Timestamp captureTimestamp() const final {
+        return buffer.getCaptureTime();
+    }
+
  private:
     std::thread producer;
     bool errored = false;
@@ -77,12 +77,18 @@ class Spectrogram : public Module, public Compute, public Present {
 
     Render::Texture& getTexture();
 
+    // Displayed bin intensities, built by the last finalize.
+    constexpr const Tensor<D, F32>& getFrequencyBins() const {
+        return frequencyBins;
+    }
+
  protected:
     Result createCompute(const RuntimeMetadata& meta) final;
     Result compute(const RuntimeMetadata& meta) final;
 
     Result createPresent() final;
     Result present() final;
+    Result finalize() final;
     Result destroyPresent() final;
 
  private:
@@ -112,6 +118,14 @@ class Spectrogram : public Module, public Compute, public Present {
     std::shared_ptr<Render::Vertex> vertex;
     std::shared_ptr<Render::Draw> drawVertex;
 
+#ifdef JETSTREAM_MODULE_SPECTROGRAM_CPU_AVAILABLE
+    struct {
+        std::vector<F32> hits;
+        U64 frames = 0;
+        F32 weight = 1.0f;
+    } cpu;
+#endif
+
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
     struct MetalConstants {
         U32 width;
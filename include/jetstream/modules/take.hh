@@ -65,6 +65,10 @@ class Take : public Module, public Compute {
 
     void info() const final;
 
+    bool outputsAliasInputs() const final {
+        return aliased;
+    }
+
     // Constructor
 
     Result create();
@@ -73,6 +77,8 @@ class Take : public Module, public Compute {
     Result compute(const RuntimeMetadata& meta) final;
 
  private:
+    bool aliased = false;
+
     JST_DEFINE_IO();
 };
 
@@ -62,6 +62,10 @@ class TensorModifier : public Module, public Compute {
         JST_INFO("  None");
     }
 
+    bool outputsAliasInputs() const final {
+        return true;
+    }
+
     // Constructor
 
     Result create() {
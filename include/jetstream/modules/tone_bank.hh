@@ -0,0 +1,123 @@
+#ifndef JETSTREAM_MODULES_TONE_BANK_HH
+#define JETSTREAM_MODULES_TONE_BANK_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_TONE_BANK_CPU(MACRO) \
+    MACRO(ToneBank, CPU, CF32)
+
+// Tracks a few DFT bins of a {samples} or {batch, samples} stream with a
+// recursive sliding DFT. Each bin is the DFT of the last `window` samples at
+// its frequency, updated every sample and published every `hop` samples as
+// a {bins, samples / hop} (or {batch, bins, samples / hop}) tensor. The
+// window slides across frames.
+//
+// A bin costs 16 flops per sample whatever the hop. An FFT of `window`
+// points every `hop` samples costs 5 · log2(window) · window / hop flops per
+// sample. The bank is cheaper with fewer bins than that divided by 16, e.g.
+// 4 bins for an 8192-point FFT without overlap, but 130 bins for the same
+// FFT every 256 samples.
+
+template<Device D, typename T = CF32>
+class ToneBank : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        std::vector<F32> frequencies = {0.0e6f};
+        F32 sampleRate = 2.0e6f;
+        U64 window = 1024;
+        U64 hop = 256;
+
+        JST_SERDES(frequencies, sampleRate, window, hop);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    // Constructor
+
+    Result create();
+
+    // Benchmark
+
+    F64 benchmark_flops() const {
+        // Two complex products and two complex additions per bin and sample.
+        return 16.0 * static_cast<F64>(config.frequencies.size()) * static_cast<F64>(input.buffer.size());
+    }
+
+ protected:
+    Result createCompute(const RuntimeMetadata& meta) final;
+    Result destroyCompute(const RuntimeMetadata& meta) final;
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    U64 numberOfChannels = 0;
+    U64 numberOfSamples = 0;
+
+#ifdef JETSTREAM_MODULE_TONE_BANK_CPU_AVAILABLE
+    struct {
+        std::vector<F32> twiddleReal;
+        std::vector<F32> twiddleImag;
+        std::vector<F32> windowTwiddleReal;
+        std::vector<F32> windowTwiddleImag;
+        std::vector<F32> stateReal;
+        std::vector<F32> stateImag;
+        std::vector<CF32> history;
+        U64 cursor = 0;
+    } cpu;
+#endif
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_TONE_BANK_CPU_AVAILABLE
+JST_TONE_BANK_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef JETSTREAM_MODULES_TRANSPOSE_HH
+#define JETSTREAM_MODULES_TRANSPOSE_HH
+
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+#include "jetstream/types.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/compute/graph/base.hh"
+
+namespace Jetstream {
+
+#define JST_TRANSPOSE_CPU(MACRO) \
+    MACRO(Transpose, CPU, CF32) \
+    MACRO(Transpose, CPU, F32)
+
+// Reorders the axes of the input (e.g. {channels, time} into {time, channels})
+// and writes the result into a dense tensor. Output axis `i` is input axis
+// `axes[i]`. Empty axes reverse the axes.
+
+template<Device D, typename T = CF32>
+class Transpose : public Module, public Compute {
+ public:
+    // Configuration 
+
+    struct Config {
+        std::vector<U64> axes = {};
+
+        JST_SERDES(axes);
+    };
+
+    constexpr const Config& getConfig() const {
+        return config;
+    }
+
+    // Input
+
+    struct Input {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_INPUT(buffer);
+    };
+
+    constexpr const Input& getInput() const {
+        return input;
+    }
+
+    // Output
+
+    struct Output {
+        Tensor<D, T> buffer;
+
+        JST_SERDES_OUTPUT(buffer);
+    };
+
+    constexpr const Output& getOutput() const {
+        return output;
+    }
+
+    constexpr const Tensor<D, T>& getOutputBuffer() const {
+        return this->output.buffer;
+    }
+
+    // Taint & Housekeeping
+
+    constexpr Device device() const {
+        return D;
+    }
+
+    void info() const final;
+
+    bool outputsAliasInputs() const final {
+        return aliased;
+    }
+
+    // Constructor
+
+    Result create();
+
+    // Parses a list of axes ("[1, 0]").
+
+    static Result ParseAxes(const std::string& text, std::vector<U64>& axes);
+
+ protected:
+    Result compute(const RuntimeMetadata& meta) final;
+
+ private:
+    Tensor<D, T> view;
+    bool aliased = false;
+    bool blocked = false;
+    U64 fastAxis = 0;
+
+    JST_DEFINE_IO();
+};
+
+#ifdef JETSTREAM_MODULE_TRANSPOSE_CPU_AVAILABLE
+JST_TRANSPOSE_CPU(JST_SPECIALIZATION);
+#endif
+
+}  // namespace Jetstream
+
+#endif
@@ -28,8 +28,12 @@ class Parser {
         std::any object;
         U64 hash = 0;
         void* data = nullptr;
+        U64 sizeBytes = 0;
         Locale locale = {};
         Device device = Device::None;
+        bool staged = false;
+        bool contiguous = true;
+        std::shared_ptr<TensorStorageMetadata::CopyOnWrite> copyOnWrite;
         std::string dataType = "";
         std::vector<U64> shape = {};
         std::map<std::string, std::string> attributes = {};
@@ -56,7 +60,11 @@ class Parser {
         if constexpr (IsTensor<T>::value) {
             metadata.hash = variable.hash();
             metadata.data = variable.data();
+            metadata.sizeBytes = variable.size_bytes();
             metadata.device = variable.device();
+            metadata.staged = variable.staged_devices().contains(variable.device());
+            metadata.contiguous = variable.contiguous();
+            metadata.copyOnWrite = variable.copy_on_write_state();
             metadata.dataType = NumericTypeInfo<typename T::DataType>::name;
             metadata.shape = variable.shape();
             metadata.locale = variable.locale();
@@ -99,6 +107,13 @@ class Parser {
                     variable = std::move(T(std::any_cast<Tensor<Device::Metal, typename T::DataType>>(anyVar)));
                     return Result::SUCCESS;
                 }
+#endif
+#ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
+                if (anyVar.type() == typeid(Tensor<Device::Vulkan, typename T::DataType>)) {
+                    JST_TRACE("Deserializing '{}': Trying to convert 'Tensor<Vulkan>' into 'Tensor<CPU>'.", name);
+                    variable = std::move(T(std::any_cast<Tensor<Device::Vulkan, typename T::DataType>>(anyVar)));
+                    return Result::SUCCESS;
+                }
 #endif
             } else if (variable.device() == Device::Metal) {
 #ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
@@ -107,6 +122,14 @@ class Parser {
                     variable = std::move(T(std::any_cast<Tensor<Device::CPU, typename T::DataType>>(anyVar)));
                     return Result::SUCCESS;
                 }
+#endif
+            } else if (variable.device() == Device::Vulkan) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+                if (anyVar.type() == typeid(Tensor<Device::CPU, typename T::DataType>)) {
+                    JST_TRACE("Deserializing '{}': Trying to convert 'Tensor<CPU>' into 'Tensor<Vulkan>'.", name);
+                    variable = std::move(T(std::any_cast<Tensor<Device::CPU, typename T::DataType>>(anyVar)));
+                    return Result::SUCCESS;
+                }
 #endif
             }
         }
@@ -0,0 +1,95 @@
+#ifndef JETSTREAM_PERF_COUNTERS_HH
+#define JETSTREAM_PERF_COUNTERS_HH
+
+#include <array>
+
+#include "jetstream/types.hh"
+#include "jetstream/macros.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+// Hardware performance counters of the calling thread.
+// Backed by perf_event_open on Linux. Other platforms (or containers
+// without access to the PMU) report the counters as unavailable and
+// every sample is zero. When the kernel multiplexes the PMU, counts are
+// scaled by the fraction of the window the group was scheduled.
+
+class JETSTREAM_API PerfCounters {
+ public:
+    enum class Event : U8 {
+        Cycles       = 0,
+        Instructions = 1,
+        CacheMisses  = 2,
+        BranchMisses = 3,
+    };
+
+    static constexpr U64 EventCount = 4;
+
+    struct Sample {
+        U64 cycles = 0;
+        U64 instructions = 0;
+        U64 cacheMisses = 0;
+        U64 branchMisses = 0;
+
+        F64 ipc() const {
+            return (cycles > 0) ? static_cast<F64>(instructions) / cycles : 0.0;
+        }
+
+        F64 cacheMissesPerKiloInstruction() const {
+            return (instructions > 0) ? (static_cast<F64>(cacheMisses) * 1000.0) / instructions : 0.0;
+        }
+
+        F64 branchMissesPerKiloInstruction() const {
+            return (instructions > 0) ? (static_cast<F64>(branchMisses) * 1000.0) / instructions : 0.0;
+        }
+
+        Sample& operator+=(const Sample& other) {
+            cycles += other.cycles;
+            instructions += other.instructions;
+            cacheMisses += other.cacheMisses;
+            branchMisses += other.branchMisses;
+            return *this;
+        }
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // Opens the counters for the calling thread. Counters only
+    // measure the thread that opened them.
+    Result open();
+    void close();
+
+    // Marks the beginning of a measured region.
+    void begin();
+
+    // Returns the counter delta since the last begin().
+    Sample end();
+
+    constexpr bool available() const {
+        return groupFd >= 0;
+    }
+
+    constexpr bool has(const Event& event) const {
+        return indices[static_cast<U8>(event)] >= 0;
+    }
+
+ private:
+    I32 groupFd = -1;
+    std::array<I32, EventCount> fds;
+    std::array<I32, EventCount> indices;
+    std::array<U64, EventCount> snapshot;
+    U64 snapshotEnabled = 0;
+    U64 snapshotRunning = 0;
+    U64 openedCount = 0;
+
+    bool read(std::array<U64, EventCount>& values, U64& enabled, U64& running) const;
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -4,6 +4,7 @@
 #include <queue>
 #include <memory>
 #include <thread>
+#include <chrono>
 
 #include "jetstream/types.hh"
 #include "jetstream/logger.hh"
@@ -27,8 +28,10 @@ class Window {
     struct Config {
         F32 scale = 1.0f;
         bool imgui = true;
+        bool renderOnDemand = false;
+        F32 idleFramerate = 1.0f;
 
-        JST_SERDES(scale, imgui);
+        JST_SERDES(scale, imgui, renderOnDemand, idleFramerate);
     };
 
     struct Stats {
@@ -52,6 +55,12 @@ class Window {
     Result bind(const std::shared_ptr<Surface>& surface);
     Result unbind(const std::shared_ptr<Surface>& surface);
 
+    // Render-on-demand. Returns false when the frame can be skipped because
+    // there are no input events, window resizes, surface changes or new data
+    // (`dirty`) and the idle framerate period didn't elapse. Always true if
+    // disabled.
+    bool shouldDraw(const bool& dirty);
+
     template<class T>
     inline Result JETSTREAM_API build(std::shared_ptr<T>& member,
                                       const auto& config) {
@@ -94,6 +103,8 @@ class Window {
     virtual Result bindSurface(const std::shared_ptr<Surface>& surface) = 0;
     virtual Result unbindSurface(const std::shared_ptr<Surface>& surface) = 0;
 
+    virtual bool resizePending() const = 0;
+
  private:
     bool graphicalLoopThreadStarted;
     std::thread::id graphicalLoopThreadId;
@@ -104,6 +115,9 @@ class Window {
     std::queue<std::shared_ptr<Surface>> surfaceBindQueue;
     std::queue<std::shared_ptr<Surface>> surfaceUnbindQueue;
 
+    std::chrono::steady_clock::time_point lastDraw;
+    std::chrono::steady_clock::time_point lastActivity;
+
     void ImGuiStyleSetup();
     void ImGuiStyleScale();
     void ImNodesStyleSetup();
@@ -33,6 +33,10 @@ class WindowImp<Device::Metal> : public Window {
     Result bindSurface(const std::shared_ptr<Surface>& surface) override;
     Result unbindSurface(const std::shared_ptr<Surface>& surface) override;
 
+    bool resizePending() const override {
+        return viewport->resizePending();
+    }
+
  private:
     Stats statsData;
     ImGuiIO* io = nullptr;
@@ -0,0 +1,3 @@
+// VkFFT includes the glslang C interface by its bare name.
+// Forward it to the installed glslang header.
+#include <glslang/Include/glslang_c_interface.h>
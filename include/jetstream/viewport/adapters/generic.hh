@@ -55,6 +55,12 @@ class Generic {
     virtual Result pollEvents() = 0;
     virtual bool keepRunning() = 0;
 
+    // True when the window changed size and the swapchain wasn't recreated
+    // yet. Viewports without a resizable window never report one.
+    virtual bool resizePending() const {
+        return false;
+    }
+
     Result addMousePosEvent(F32 x, F32 y);
     Result addMouseButtonEvent(U64 button, bool down);
 
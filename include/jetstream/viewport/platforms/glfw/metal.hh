@@ -40,6 +40,7 @@ class GLFW<Device::Metal> : public Adapter<Device::Metal> {
     
     Result pollEvents();
     bool keepRunning();
+    bool resizePending() const;
 
  private:
     GLFWwindow* window = nullptr;
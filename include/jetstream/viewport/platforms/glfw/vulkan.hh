@@ -4,6 +4,8 @@
 #include "jetstream/viewport/adapters/vulkan.hh"
 #include "jetstream/viewport/platforms/glfw/generic.hh"
 
+#include <atomic>
+
 #include <GLFW/glfw3.h>
 
 namespace Jetstream::Viewport {
@@ -42,6 +44,7 @@ class GLFW<Device::Vulkan> : public Adapter<Device::Vulkan> {
 
     Result pollEvents();
     bool keepRunning();
+    bool resizePending() const;
     Result nextDrawable(VkSemaphore& semaphore);
     Result commitDrawable(std::vector<VkSemaphore>& semaphores);
 
@@ -58,7 +61,7 @@ class GLFW<Device::Vulkan> : public Adapter<Device::Vulkan> {
     };
 
     GLFWwindow* window = nullptr;
-    bool framebufferDidResize = false;
+    std::atomic<bool> framebufferDidResize = false;
     U32 _currentDrawableIndex;
     VkSurfaceKHR surface;
     VkSwapchainKHR swapchain;
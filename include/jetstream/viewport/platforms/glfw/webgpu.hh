@@ -41,6 +41,7 @@ class GLFW<Device::WebGPU> : public Adapter<Device::WebGPU> {
     
     Result pollEvents();
     bool keepRunning();
+    bool resizePending() const;
 
  private:
     GLFWwindow* window;
@@ -2,6 +2,7 @@
 #define JETSTREAM_VIEWPORT_PLUGINS_ENDPOINT_HH
 
 #include "jetstream/viewport/adapters/generic.hh"
+#include "jetstream/latency.hh"
 
 #ifdef JETSTREAM_LOADER_GSTREAMER_AVAILABLE
 #include <gst/gst.h>
@@ -63,6 +64,9 @@ class Endpoint {
 
     Device viewportDevice = Device::None;
 
+    Latency::Tracker latency;
+    Latency::Timestamp lastDisplayed;
+
 #ifndef JST_OS_WINDOWS
     Result createPipeEndpoint();
     Result destroyPipeEndpoint();
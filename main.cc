@@ -12,6 +12,9 @@ int main(int argc, char* argv[]) {
     Render::Window::Config renderConfig;
     std::string flowgraphPath;
     Device prefferedBackend;
+    bool enableProfiling = false;
+    std::string metricsEndpoint;
+    std::string metricsDumpPath;
 
     for (int i = 1; i < argc; i++) {
         const std::string arg = std::string(argv[i]);
@@ -68,6 +71,28 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        if (arg == "--profile") {
+            enableProfiling = true;
+
+            continue;
+        }
+
+        if (arg == "--metrics") {
+            if (i + 1 < argc) {
+                metricsEndpoint = argv[++i];
+            }
+
+            continue;
+        }
+
+        if (arg == "--metrics-dump") {
+            if (i + 1 < argc) {
+                metricsDumpPath = argv[++i];
+            }
+
+            continue;
+        }
+
         if (arg == "--framerate") {
             if (i + 1 < argc) {
                 viewportConfig.framerate = std::stoul(argv[++i]);
@@ -109,6 +134,66 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--workers") {
+            if (i + 1 < argc) {
+                backendConfig.workerThreads = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--compute-core") {
+            if (i + 1 < argc) {
+                backendConfig.computeCore = std::stol(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--render-core") {
+            if (i + 1 < argc) {
+                backendConfig.renderCore = std::stol(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--source-core") {
+            if (i + 1 < argc) {
+                backendConfig.sourceCore = std::stol(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--realtime") {
+            if (i + 1 < argc) {
+                backendConfig.realtimePriority = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--lock-memory") {
+            backendConfig.lockMemory = true;
+
+            continue;
+        }
+
+        if (arg == "--render-on-demand") {
+            renderConfig.renderOnDemand = true;
+
+            continue;
+        }
+
+        if (arg == "--idle-framerate") {
+            if (i + 1 < argc) {
+                renderConfig.idleFramerate = std::stof(argv[++i]);
+            }
+
+            continue;
+        }
+
         if (arg == "--scale") {
             if (i + 1 < argc) {
                 renderConfig.scale = std::stof(argv[++i]);
@@ -127,6 +212,8 @@ int main(int argc, char* argv[]) {
             std::cout << "  --codec [codec]         Set the video codec of the headless viewport. Default: `FFV1`" << std::endl;
             std::cout << "  --size [width] [height] Set the initial size of the viewport. Default: `1920 1080`" << std::endl;
             std::cout << "  --scale [scale]         Set the scale of the render window. Default: `1.0`" << std::endl;
+            std::cout << "  --render-on-demand      Only redraw on input, new data or at the idle framerate." << std::endl;
+            std::cout << "  --idle-framerate [fps]  Set the minimum framerate of the render-on-demand mode. Default: `1`" << std::endl;
             std::cout << "  --benchmark [type]      Run the benchmark and output the results (`markdown`, `json`, or `csv`). Default: `markdown`" << std::endl;
             std::cout << "  --no-hw-acceleration    Disable hardware acceleration. Enabled otherwise." << std::endl;
             std::cout << "Other Options:" << std::endl;
@@ -134,6 +221,16 @@ int main(int argc, char* argv[]) {
             std::cout << "  --device-id [id]        Set the physical device ID. Default: `0`" << std::endl;
             std::cout << "  --no-validation         Disable Vulkan validation layers. Enabled otherwise." << std::endl;
             std::cout << "  --no-vsync              Disable vsync. Enabled otherwise." << std::endl;
+            std::cout << "  --profile               Enable the per-module compute profiler. Disabled otherwise." << std::endl;
+            std::cout << "  --metrics [endpoint]    Serve Prometheus metrics (`127.0.0.1:9464` or `unix:/tmp/cyberether.sock`)." << std::endl;
+            std::cout << "  --metrics-dump [path]   Periodically dump metrics as JSON to a file." << std::endl;
+            std::cout << "CPU Options:" << std::endl;
+            std::cout << "  --workers [count]       Set the number of worker threads. Default: `cores - 1`" << std::endl;
+            std::cout << "  --compute-core [core]   Pin the compute thread to a core." << std::endl;
+            std::cout << "  --render-core [core]    Pin the render thread to a core." << std::endl;
+            std::cout << "  --source-core [core]    Pin the source threads (e.g. SDR ingest) to a core." << std::endl;
+            std::cout << "  --realtime [priority]   Run the source and compute threads with SCHED_FIFO (1-99)." << std::endl;
+            std::cout << "  --lock-memory           Lock the process memory (mlockall) to avoid page faults." << std::endl;
             std::cout << "Other:" << std::endl;
             std::cout << "  --help, -h              Print this help message." << std::endl;
             std::cout << "  --version, -v           Print the version." << std::endl;
@@ -157,14 +254,32 @@ int main(int argc, char* argv[]) {
                                                    viewportConfig,
                                                    renderConfig));
 
+    instance.scheduler().setProfiling(enableProfiling);
+
+    if (!metricsEndpoint.empty()) {
+        JST_CHECK_THROW(Metrics::StartExporter(metricsEndpoint));
+    }
+
+    if (!metricsDumpPath.empty()) {
+        JST_CHECK_THROW(Metrics::StartDump(metricsDumpPath));
+    }
+
     if (!flowgraphPath.empty()) {
         JST_CHECK_THROW(instance.flowgraph().create(flowgraphPath));
     }
     
     // Start compute thread.
 
+    // The backend registry isn't thread-safe. Each loop resolves it once.
+
     auto computeThread = std::thread([&]{
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        auto* cpu = Backend::State<Device::CPU>().get();
+#endif
         while (instance.viewport().keepRunning()) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+            cpu->applyThreadPolicy(Backend::CPU::ThreadRole::Compute);
+#endif
             JST_CHECK_THROW(instance.compute());
         }
     });
@@ -187,7 +302,13 @@ int main(int argc, char* argv[]) {
     emscripten_set_main_loop_arg(graphicalThreadLoop, &instance, 0, 1);
 #else
     auto graphicalThread = std::thread([&]{
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        auto* cpu = Backend::State<Device::CPU>().get();
+#endif
         while (instance.viewport().keepRunning()) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+            cpu->applyThreadPolicy(Backend::CPU::ThreadRole::Render);
+#endif
             graphicalThreadLoop(&instance);
         }
     });
@@ -212,6 +333,8 @@ int main(int argc, char* argv[]) {
     
     instance.destroy();
 
+    Metrics::Stop();
+
     Backend::DestroyAll();
 
     return 0;
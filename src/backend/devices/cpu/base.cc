@@ -1,10 +1,394 @@
+#include <algorithm>
+
 #include "jetstream/backend/devices/cpu/base.hh"
 
 #include "jetstream/logger.hh"
 
+#if defined(JST_OS_LINUX) || defined(JST_OS_MAC)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
 namespace Jetstream::Backend {
 
-CPU::CPU(const Config&) {
+CPU::CPU(const Config& _config) : config(_config) {
+    const auto& caps = GetCapabilities();
+    JST_INFO("[CPU] {} ({} cores, {} threads, {}).", caps.processorName,
+                                                     caps.physicalCores,
+                                                     caps.logicalCores,
+                                                     caps.isa());
+
+    updateAllocationNode();
+
+    JST_CHECK_THROW(updateMemoryLock());
+}
+
+CPU::~CPU() {
+    stopWorkers();
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_MAC)
+    if (memoryLocked) {
+        munlockall();
+    }
+#endif
+}
+
+U64 CPU::getTotalProcessorCount() const {
+    return GetCapabilities().logicalCores;
+}
+
+U64 CPU::getWorkerCount() const {
+    const U64 running = workerCount.load(std::memory_order_relaxed);
+    return (running > 0) ? running : plannedWorkerCount();
+}
+
+Config CPU::getConfig() const {
+    std::lock_guard<std::mutex> lock(configMutex);
+    return config;
+}
+
+U64 CPU::plannedWorkerCount() const {
+    U64 workerThreads = 0;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        workerThreads = config.workerThreads;
+    }
+
+    // Leave one core for the compute thread itself.
+    return (workerThreads > 0) ? workerThreads : std::max<U64>(1, getTotalProcessorCount() - 1);
+}
+
+Result CPU::reconfigure(const Config& _config) {
+    // Tasks submitted meanwhile are queued until the new workers start.
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        reconfiguring = true;
+    }
+
+    JST_CHECK(stopWorkers());
+
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        config = _config;
+    }
+    policyGeneration += 1;
+
+    updateAllocationNode();
+
+    const Result result = updateMemoryLock();
+
+    // Tasks left by the previous workers still need someone to run them.
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        reconfiguring = false;
+        if (!queue.empty()) {
+            JST_CHECK(startWorkers());
+        }
+    }
+    queueCondition.notify_all();
+
+    return result;
+}
+
+//
+// Thread Policy
+//
+
+Result CPU::applyThreadPolicy(const ThreadRole& role) {
+    thread_local U64 appliedGeneration = 0;
+    thread_local ThreadRole appliedRole = ThreadRole::Worker;
+
+    const U64 generation = policyGeneration.load(std::memory_order_relaxed);
+    if (appliedGeneration == generation && appliedRole == role) {
+        return Result::SUCCESS;
+    }
+    appliedGeneration = generation;
+    appliedRole = role;
+
+    I64 core = -1;
+    U64 priority = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+
+        // Sources run one level above compute so the ring buffer is always
+        // drained faster than it is filled. Render is paced by the display
+        // and stays on the default scheduler.
+        switch (role) {
+            case ThreadRole::Source:
+                core = config.sourceCore;
+                priority = config.realtimePriority;
+                break;
+            case ThreadRole::Compute:
+                core = config.computeCore;
+                priority = (config.realtimePriority > 1) ? config.realtimePriority - 1 : config.realtimePriority;
+                break;
+            case ThreadRole::Worker:
+                priority = (config.realtimePriority > 1) ? config.realtimePriority - 1 : config.realtimePriority;
+                break;
+            case ThreadRole::Render:
+                core = config.renderCore;
+                break;
+        }
+    }
+
+    Result result = Result::SUCCESS;
+
+#if defined(JST_OS_LINUX)
+    if (core >= 0) {
+        if (static_cast<U64>(core) >= getTotalProcessorCount()) {
+            JST_WARN("[CPU] Can't pin thread to core {}. Only {} cores available.", core, getTotalProcessorCount());
+            result = Result::WARNING;
+        } else {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+                JST_WARN("[CPU] Failed to pin thread to core {}.", core);
+                result = Result::WARNING;
+            } else {
+                JST_DEBUG("[CPU] Thread pinned to core {}.", core);
+            }
+        }
+    }
+#else
+    if (core >= 0) {
+        JST_WARN("[CPU] Thread pinning is not supported in this platform.");
+        result = Result::WARNING;
+    }
+#endif
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_MAC)
+    sched_param param{};
+    int policy = SCHED_OTHER;
+
+    if (priority > 0) {
+        policy = SCHED_FIFO;
+        param.sched_priority = std::clamp<int>(priority,
+                                               sched_get_priority_min(SCHED_FIFO),
+                                               sched_get_priority_max(SCHED_FIFO));
+    }
+
+    if (pthread_setschedparam(pthread_self(), policy, &param) != 0) {
+        if (priority > 0) {
+            JST_WARN("[CPU] Failed to set SCHED_FIFO priority {}. "
+                     "Check the process capabilities (CAP_SYS_NICE) or `ulimit -r`.", param.sched_priority);
+            result = Result::WARNING;
+        }
+    } else if (priority > 0) {
+        JST_DEBUG("[CPU] Thread scheduled with SCHED_FIFO priority {}.", param.sched_priority);
+    }
+#else
+    if (priority > 0) {
+        JST_WARN("[CPU] Real-time priorities are not supported in this platform.");
+        result = Result::WARNING;
+    }
+#endif
+
+    return result;
+}
+
+Result CPU::updateMemoryLock() {
+    bool lockMemory = false;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        lockMemory = config.lockMemory;
+    }
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_MAC)
+    if (lockMemory && !memoryLocked) {
+        // Future allocations are locked too. Tensors and ring buffers are
+        // allocated after the backend, so they never page fault on the hot path.
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            JST_WARN("[CPU] Failed to lock memory. Check the process capabilities (CAP_IPC_LOCK) or `ulimit -l`.");
+            return Result::SUCCESS;
+        }
+        JST_INFO("[CPU] Process memory locked.");
+        memoryLocked = true;
+    }
+
+    if (!lockMemory && memoryLocked) {
+        munlockall();
+        memoryLocked = false;
+    }
+#else
+    if (lockMemory) {
+        JST_WARN("[CPU] Memory locking is not supported in this platform.");
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+//
+// Worker Pool
+//
+
+// Must be called with the queue mutex held.
+Result CPU::startWorkers() {
+    const U64 count = plannedWorkerCount();
+    const U64 nodes = GetNumaNodeCount();
+
+    JST_DEBUG("[CPU] Starting {} worker threads across {} NUMA node(s).", count, nodes);
+
+    workersRunning = true;
+    nodeQueues.resize(nodes);
+
+    for (U64 i = 0; i < count; i++) {
+        const I64 node = (nodes > 1) ? static_cast<I64>(i % nodes) : -1;
+
+        workers.emplace_back([&, node]{
+            BindThreadToNumaNode(node);
+
+            while (true) {
+                applyThreadPolicy(ThreadRole::Worker);
+
+                std::packaged_task<void()> task;
+
+                {
+                    std::unique_lock<std::mutex> lock(queueMutex);
+
+                    auto* local = (node >= 0) ? &nodeQueues[node] : nullptr;
+                    queueCondition.wait(lock, [&]{
+                        return !workersRunning || !queue.empty() || (local && !local->empty());
+                    });
+
+                    if (local && !local->empty()) {
+                        task = std::move(local->front());
+                        local->pop_front();
+                    } else if (!queue.empty()) {
+                        task = std::move(queue.front());
+                        queue.pop_front();
+                    } else {
+                        return;
+                    }
+                }
+
+                task();
+            }
+        });
+    }
+
+    workerCount = count;
+
+    return Result::SUCCESS;
+}
+
+// Must be called while `submit()` can't start workers, i.e. while
+// reconfiguring or on destruction. The workers take the queue mutex to
+// exit, so it's only held around the shared state.
+Result CPU::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        workersRunning = false;
+        workerCount = 0;
+    }
+    queueCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+
+    // Tasks bound to a node without workers run on any worker.
+    std::lock_guard<std::mutex> lock(queueMutex);
+    for (auto& nodeQueue : nodeQueues) {
+        std::move(nodeQueue.begin(), nodeQueue.end(), std::back_inserter(queue));
+        nodeQueue.clear();
+    }
+
+    return Result::SUCCESS;
+}
+
+std::future<void> CPU::submit(std::function<void()> task, const I64& node) {
+    std::packaged_task<void()> packaged(std::move(task));
+    auto future = packaged.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+
+        if (!workersRunning && !reconfiguring) {
+            startWorkers();
+        }
+
+        if (node >= 0 && static_cast<U64>(node) < nodeQueues.size() && workerCount > static_cast<U64>(node)) {
+            nodeQueues[node].push_back(std::move(packaged));
+        } else {
+            queue.push_back(std::move(packaged));
+        }
+    }
+
+    // Only workers of the node can take a bound task.
+    if (node >= 0) {
+        queueCondition.notify_all();
+    } else {
+        queueCondition.notify_one();
+    }
+
+    return future;
+}
+
+Result CPU::parallelFor(const U64& count, const std::function<void(const U64&)>& task) {
+    if (count == 0) {
+        return Result::SUCCESS;
+    }
+
+    const U64 shares = std::min<U64>(count, getWorkerCount() + 1);
+
+    if (shares == 1) {
+        for (U64 i = 0; i < count; i++) {
+            task(i);
+        }
+        return Result::SUCCESS;
+    }
+
+    // Shares are claimed from a counter. The calling thread keeps claiming
+    // until none are left, so it never waits for a share no worker picked
+    // up. This matters when the caller is a busy pool worker itself.
+
+    struct State {
+        std::atomic<U64> next{0};
+        std::atomic<bool> failed{false};
+        std::mutex mutex;
+        std::condition_variable condition;
+        U64 done = 0;
+    };
+
+    auto state = std::make_shared<State>();
+
+    const auto work = [state, &task, count, shares]{
+        U64 share;
+        while ((share = state->next.fetch_add(1)) < shares) {
+            try {
+                const U64 end = (count * (share + 1)) / shares;
+                for (U64 i = (count * share) / shares; i < end; i++) {
+                    task(i);
+                }
+            } catch (...) {
+                state->failed = true;
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (++state->done == shares) {
+                state->condition.notify_all();
+            }
+        }
+    };
+
+    for (U64 share = 1; share < shares; share++) {
+        submit(work);
+    }
+
+    // The calling thread takes a share of the work instead of idling.
+    work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&]{ return state->done == shares; });
+
+    return (state->failed) ? Result::ERROR : Result::SUCCESS;
 }
 
 }  // namespace Jetstream::Backend
@@ -0,0 +1,107 @@
+#include "jetstream/benchmark.hh"
+#include "jetstream/backend/devices/cpu/math.hh"
+
+#include <random>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+namespace Jetstream {
+
+// Transcendental kernels at every accuracy tier. Each run reports the
+// maximum error against double precision next to the speed.
+
+static void BenchmarkMath(ankerl::nanobench::Bench& bench, std::string name) {
+    using Backend::MathAccuracy;
+
+    constexpr U64 size = 65536;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<F32> magnitude(-6.0f, 6.0f);
+    std::uniform_real_distribution<F32> angle(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<F32> coordinate(-10.0f, 10.0f);
+    std::uniform_real_distribution<F32> exponent(-80.0f, 80.0f);
+
+    std::vector<F32> logInput(size), atanY(size), atanX(size), expInput(size), sincosInput(size);
+    for (U64 i = 0; i < size; i++) {
+        logInput[i] = std::pow(10.0f, magnitude(generator));
+        atanY[i] = coordinate(generator);
+        atanX[i] = coordinate(generator);
+        expInput[i] = exponent(generator);
+        sincosInput[i] = angle(generator);
+    }
+
+    std::vector<F32> outputA(size), outputB(size);
+
+    const auto run = [&](const std::string& label,
+                         const U64& bytes,
+                         const std::function<void()>& kernel,
+                         const std::function<F64(const U64&)>& error) {
+        const auto entry = name + label;
+
+        kernel();
+        F64 maxError = 0.0;
+        for (U64 i = 0; i < size; i++) {
+            maxError = std::max(maxError, error(i));
+        }
+
+        U64 calls = 0;
+        Benchmark::CountersBegin();
+        bench.run(entry, [&] {
+            kernel();
+            calls++;
+        });
+        Benchmark::CountersEnd(entry, calls);
+
+        Benchmark::SetWorkload(entry, bytes, 0.0);
+        Benchmark::SetAccuracy(entry, maxError);
+    };
+
+    const std::vector<std::pair<std::string, MathAccuracy>> tiers = {
+        {"Fast", MathAccuracy::Fast},
+        {"Balanced", MathAccuracy::Balanced},
+        {"Exact", MathAccuracy::Exact},
+    };
+
+    for (const auto& [tier, accuracy] : tiers) {
+        run("Log10 " + tier, 2 * size * sizeof(F32), [&]{
+            Backend::Log10(accuracy, logInput.data(), outputA.data(), size);
+        }, [&](const U64& i) {
+            return std::fabs(outputA[i] - std::log10(static_cast<F64>(logInput[i])));
+        });
+    }
+
+    for (const auto& [tier, accuracy] : tiers) {
+        run("Atan2 " + tier, 3 * size * sizeof(F32), [&]{
+            Backend::Atan2(accuracy, atanY.data(), atanX.data(), outputA.data(), size);
+        }, [&](const U64& i) {
+            return std::fabs(outputA[i] - std::atan2(static_cast<F64>(atanY[i]), static_cast<F64>(atanX[i])));
+        });
+    }
+
+    for (const auto& [tier, accuracy] : tiers) {
+        run("Exp " + tier, 2 * size * sizeof(F32), [&]{
+            Backend::Exp(accuracy, expInput.data(), outputA.data(), size);
+        }, [&](const U64& i) {
+            const F64 reference = std::exp(static_cast<F64>(expInput[i]));
+            return std::fabs(outputA[i] - reference) / reference;
+        });
+    }
+
+    for (const auto& [tier, accuracy] : tiers) {
+        run("SinCos " + tier, 3 * size * sizeof(F32), [&]{
+            Backend::SinCos(accuracy, sincosInput.data(), outputA.data(), outputB.data(), size);
+        }, [&](const U64& i) {
+            const F64 x = sincosInput[i];
+            return std::max(std::fabs(outputA[i] - std::sin(x)), std::fabs(outputB[i] - std::cos(x)));
+        });
+    }
+}
+
+static bool MathBenchmark __attribute__((used)) = []() -> bool {
+    Benchmark::Add("Math", "CPU", "F32", BenchmarkMath);
+    return true;
+}();
+
+}  // namespace Jetstream
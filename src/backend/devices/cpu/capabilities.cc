@@ -0,0 +1,267 @@
+#include <set>
+#include <cmath>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "jetstream/backend/devices/cpu/base.hh"
+
+#include "jetstream/logger.hh"
+
+#if defined(JST_OS_LINUX)
+#include <sys/auxv.h>
+#endif
+
+#if defined(JST_OS_MAC) || defined(JST_OS_IOS)
+#include <sys/sysctl.h>
+#endif
+
+namespace Jetstream::Backend {
+
+#if defined(JST_OS_LINUX)
+
+static std::string ReadLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// Sysfs sizes are formatted as `32K`, `1024K` or `32M`.
+static U64 ParseSize(const std::string& str) {
+    if (str.empty()) {
+        return 0;
+    }
+
+    U64 value = 0;
+    try {
+        value = std::stoull(str);
+    } catch (...) {
+        return 0;
+    }
+
+    switch (str.back()) {
+        case 'K':
+            return value * 1024;
+        case 'M':
+            return value * 1024 * 1024;
+        case 'G':
+            return value * 1024 * 1024 * 1024;
+        default:
+            return value;
+    }
+}
+
+static void DetectLinux(CPU::Capabilities& caps) {
+    // Processor name.
+
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.starts_with("model name") || line.starts_with("Model")) {
+            const auto separator = line.find(':');
+            if (separator != std::string::npos && separator + 2 <= line.size()) {
+                caps.processorName = line.substr(separator + 2);
+                break;
+            }
+        }
+    }
+
+    // Caches of the first processor.
+
+    for (U64 index = 0; index < 8; index++) {
+        const auto base = fmt::format("/sys/devices/system/cpu/cpu0/cache/index{}/", index);
+        const auto level = ReadLine(base + "level");
+        if (level.empty()) {
+            break;
+        }
+
+        const auto type = ReadLine(base + "type");
+        const auto size = ParseSize(ReadLine(base + "size"));
+        const auto lineSize = ParseSize(ReadLine(base + "coherency_line_size"));
+
+        if (level == "1" && (type == "Data" || type == "Unified")) {
+            caps.l1DataCacheSize = size;
+            if (lineSize > 0) {
+                caps.cacheLineSize = lineSize;
+            }
+        } else if (level == "2") {
+            caps.l2CacheSize = size;
+        } else if (level == "3") {
+            caps.l3CacheSize = size;
+        }
+    }
+
+    // Physical cores are unique package and core id pairs.
+
+    std::set<std::pair<std::string, std::string>> cores;
+    for (U64 i = 0; i < caps.logicalCores; i++) {
+        const auto base = fmt::format("/sys/devices/system/cpu/cpu{}/topology/", i);
+        const auto package = ReadLine(base + "physical_package_id");
+        const auto core = ReadLine(base + "core_id");
+        if (core.empty()) {
+            continue;
+        }
+        cores.insert({package, core});
+    }
+    if (!cores.empty()) {
+        caps.physicalCores = cores.size();
+    }
+
+    // NUMA nodes. The list format is `0-15,32-47`.
+
+    for (U64 node = 0; ; node++) {
+        const auto list = ReadLine(fmt::format("/sys/devices/system/node/node{}/cpulist", node));
+        if (list.empty()) {
+            break;
+        }
+
+        std::vector<U64> cpus;
+        std::stringstream stream(list);
+        std::string range;
+        while (std::getline(stream, range, ',')) {
+            try {
+                const auto dash = range.find('-');
+                const U64 first = std::stoull(range.substr(0, dash));
+                const U64 last = (dash == std::string::npos) ? first : std::stoull(range.substr(dash + 1));
+                for (U64 cpu = first; cpu <= last; cpu++) {
+                    cpus.push_back(cpu);
+                }
+            } catch (...) {
+                continue;
+            }
+        }
+        caps.numaNodes.push_back(cpus);
+    }
+
+    // Scalable vectors.
+
+#if defined(__aarch64__) && defined(HWCAP_SVE)
+    caps.sve = (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#endif
+}
+
+#endif
+
+#if defined(JST_OS_MAC) || defined(JST_OS_IOS)
+
+template<typename T>
+static T SysctlValue(const char* name) {
+    T value = 0;
+    size_t size = sizeof(value);
+    if (sysctlbyname(name, &value, &size, nullptr, 0) != 0) {
+        return 0;
+    }
+    return value;
+}
+
+static void DetectApple(CPU::Capabilities& caps) {
+    char name[256] = {};
+    size_t size = sizeof(name);
+    if (sysctlbyname("machdep.cpu.brand_string", name, &size, nullptr, 0) == 0) {
+        caps.processorName = name;
+    }
+
+    caps.physicalCores = SysctlValue<I32>("hw.physicalcpu");
+    caps.l1DataCacheSize = SysctlValue<I64>("hw.l1dcachesize");
+    caps.l2CacheSize = SysctlValue<I64>("hw.l2cachesize");
+    caps.l3CacheSize = SysctlValue<I64>("hw.l3cachesize");
+
+    if (const auto lineSize = SysctlValue<I64>("hw.cachelinesize"); lineSize > 0) {
+        caps.cacheLineSize = lineSize;
+    }
+}
+
+#endif
+
+static CPU::Capabilities Detect() {
+    CPU::Capabilities caps;
+
+    caps.logicalCores = std::max(1u, std::thread::hardware_concurrency());
+
+#if defined(__x86_64__) || defined(_M_X64)
+    caps.architecture = "x86_64";
+#elif defined(__i386__) || defined(_M_IX86)
+    caps.architecture = "x86";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    caps.architecture = "aarch64";
+#elif defined(__arm__)
+    caps.architecture = "arm";
+#elif defined(__wasm__)
+    caps.architecture = "wasm";
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    caps.sse42 = __builtin_cpu_supports("sse4.2");
+    caps.avx = __builtin_cpu_supports("avx");
+    caps.avx2 = __builtin_cpu_supports("avx2");
+    caps.fma = __builtin_cpu_supports("fma");
+    caps.avx512f = __builtin_cpu_supports("avx512f");
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+    caps.neon = true;
+#endif
+
+#if defined(JST_OS_LINUX)
+    DetectLinux(caps);
+#elif defined(JST_OS_MAC) || defined(JST_OS_IOS)
+    DetectApple(caps);
+#endif
+
+    if (caps.physicalCores == 0) {
+        caps.physicalCores = caps.logicalCores;
+    }
+
+    JST_DEBUG("[CPU] {} ({}) with {} cores and {} threads.", caps.processorName,
+                                                             caps.architecture,
+                                                             caps.physicalCores,
+                                                             caps.logicalCores);
+    JST_DEBUG("[CPU] ISA: {}", caps.isa());
+    JST_DEBUG("[CPU] NUMA nodes: {}", std::max<U64>(1, caps.numaNodes.size()));
+    JST_DEBUG("[CPU] Caches: L1d {} KB, L2 {} KB, L3 {} KB, {} B lines.", caps.l1DataCacheSize / 1024,
+                                                                        caps.l2CacheSize / 1024,
+                                                                        caps.l3CacheSize / 1024,
+                                                                        caps.cacheLineSize);
+
+    return caps;
+}
+
+std::string CPU::Capabilities::isa() const {
+    std::string out;
+
+    const auto append = [&](const bool& supported, const char* name) {
+        if (supported) {
+            out += (out.empty()) ? name : fmt::format(" {}", name);
+        }
+    };
+
+    append(sse42, "SSE4.2");
+    append(avx, "AVX");
+    append(avx2, "AVX2");
+    append(fma, "FMA");
+    append(avx512f, "AVX-512F");
+    append(neon, "NEON");
+    append(sve, "SVE");
+
+    return (out.empty()) ? "Scalar" : out;
+}
+
+const CPU::Capabilities& CPU::GetCapabilities() {
+    static const Capabilities capabilities = Detect();
+    return capabilities;
+}
+
+U64 CPU::GetTileSize(const U64& elementSize) {
+    // Most L1 data caches are at least 32 KB. Used when detection fails.
+    const U64 cacheSize = (GetCapabilities().l1DataCacheSize > 0) ? GetCapabilities().l1DataCacheSize : 32 * 1024;
+    const U64 edge = static_cast<U64>(std::sqrt(static_cast<F64>(cacheSize / 2) / elementSize));
+
+    // Round down to a multiple of the cache line.
+    const U64 lineElements = std::max<U64>(1, GetCapabilities().cacheLineSize / elementSize);
+    return std::max<U64>(lineElements, (edge / lineElements) * lineElements);
+}
+
+}  // namespace Jetstream::Backend
@@ -0,0 +1,152 @@
+#include <atomic>
+#include <algorithm>
+
+#include "jetstream/backend/devices/cpu/base.hh"
+
+#include "jetstream/logger.hh"
+
+#if defined(JST_OS_LINUX)
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+namespace Jetstream::Backend {
+
+// Set by the backend from the compute core, read by every allocation.
+static std::atomic<I64> defaultAllocationNode{-1};
+
+thread_local static I64 scopedAllocationNode = -1;
+thread_local static bool scopedAllocationNodeSet = false;
+
+U64 CPU::GetNumaNodeCount() {
+    return std::max<U64>(1, GetCapabilities().numaNodes.size());
+}
+
+I64 CPU::GetNumaNodeOfCore(const I64& core) {
+    if (core < 0) {
+        return -1;
+    }
+
+    const auto& nodes = GetCapabilities().numaNodes;
+    for (U64 node = 0; node < nodes.size(); node++) {
+        if (std::find(nodes[node].begin(), nodes[node].end(), static_cast<U64>(core)) != nodes[node].end()) {
+            return node;
+        }
+    }
+
+    return -1;
+}
+
+I64 CPU::GetCurrentNumaNode() {
+#if defined(JST_OS_LINUX)
+    return GetNumaNodeOfCore(sched_getcpu());
+#else
+    return -1;
+#endif
+}
+
+I64 CPU::GetAllocationNode() {
+    if (scopedAllocationNodeSet) {
+        return scopedAllocationNode;
+    }
+    return defaultAllocationNode.load(std::memory_order_relaxed);
+}
+
+void CPU::updateAllocationNode() {
+    const I64 node = (GetNumaNodeCount() > 1) ? GetNumaNodeOfCore(config.computeCore) : -1;
+    defaultAllocationNode.store(node, std::memory_order_relaxed);
+
+    if (node >= 0) {
+        JST_INFO("[CPU] Allocating buffers on NUMA node {} (compute core {}).", node, config.computeCore);
+    }
+}
+
+CPU::NumaScope::NumaScope(const I64& node) : previous(scopedAllocationNode),
+                                             previousSet(scopedAllocationNodeSet) {
+    scopedAllocationNode = node;
+    scopedAllocationNodeSet = true;
+}
+
+CPU::NumaScope::~NumaScope() {
+    scopedAllocationNode = previous;
+    scopedAllocationNodeSet = previousSet;
+}
+
+#if defined(JST_OS_LINUX)
+
+Result CPU::BindMemory(void* ptr, const U64& size, const I64& node) {
+    if (node < 0 || ptr == nullptr || size == 0 || GetNumaNodeCount() <= 1) {
+        return Result::SUCCESS;
+    }
+
+    if (static_cast<U64>(node) >= GetNumaNodeCount()) {
+        JST_WARN("[CPU] Can't bind memory to NUMA node {}. Only {} nodes available.", node, GetNumaNodeCount());
+        return Result::WARNING;
+    }
+
+    // Values from <numaif.h>, avoids a dependency on libnuma.
+    constexpr int MpolPreferred = 1;
+    constexpr unsigned MpolMfMove = (1 << 1);
+
+    // The kernel wants the range aligned to the page size. Only pages fully
+    // inside the range are bound, partial pages at the edges may be shared
+    // with neighbouring allocations bound to another node.
+    const U64 pageSize = JST_PAGESIZE();
+    const U64 begin = (reinterpret_cast<U64>(ptr) + pageSize - 1) & ~(pageSize - 1);
+    const U64 end = (reinterpret_cast<U64>(ptr) + size) & ~(pageSize - 1);
+
+    if (begin >= end) {
+        return Result::SUCCESS;
+    }
+
+    constexpr U64 MaskBits = 64 * 4;
+    unsigned long mask[MaskBits / 64] = {};
+    mask[node / 64] |= 1UL << (node % 64);
+
+    if (syscall(SYS_mbind, begin, end - begin, MpolPreferred, mask, MaskBits + 1, MpolMfMove) != 0) {
+        JST_TRACE("[CPU] Failed to bind {} bytes to NUMA node {}.", size, node);
+        return Result::WARNING;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result CPU::BindThreadToNumaNode(const I64& node) {
+    if (node < 0 || GetNumaNodeCount() <= 1) {
+        return Result::SUCCESS;
+    }
+
+    if (static_cast<U64>(node) >= GetNumaNodeCount()) {
+        JST_WARN("[CPU] Can't bind thread to NUMA node {}. Only {} nodes available.", node, GetNumaNodeCount());
+        return Result::WARNING;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto& cpu : GetCapabilities().numaNodes[node]) {
+        CPU_SET(cpu, &set);
+    }
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        JST_WARN("[CPU] Failed to bind thread to NUMA node {}.", node);
+        return Result::WARNING;
+    }
+
+    return Result::SUCCESS;
+}
+
+#else
+
+Result CPU::BindMemory(void*, const U64&, const I64&) {
+    return Result::SUCCESS;
+}
+
+Result CPU::BindThreadToNumaNode(const I64&) {
+    return Result::SUCCESS;
+}
+
+#endif
+
+}  // namespace Jetstream::Backend
@@ -325,13 +325,20 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
             indices.presentFamily.value(),
         };
 
-        float queuePriority = 0.0f;
+        // Request a second compute queue for the compute graphs if available.
+        uint32_t queueFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+        const bool dedicatedGraphQueue = queueFamilies[indices.computeFamily.value()].queueCount > 1;
+
+        const float queuePriorities[] = {0.0f, 0.0f};
         for (uint32_t queueFamily : uniqueQueueFamilies) {
             VkDeviceQueueCreateInfo queueCreateInfo{};
             queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
             queueCreateInfo.queueFamilyIndex = queueFamily;
-            queueCreateInfo.queueCount = 1;
-            queueCreateInfo.pQueuePriorities = &queuePriority;
+            queueCreateInfo.queueCount = (queueFamily == indices.computeFamily.value() && dedicatedGraphQueue) ? 2 : 1;
+            queueCreateInfo.pQueuePriorities = queuePriorities;
             queueCreateInfos.push_back(queueCreateInfo);
         }
 
@@ -367,6 +374,13 @@ Vulkan::Vulkan(const Config& _config) : config(_config), cache({}) {
         vkGetDeviceQueue(device, indices.graphicFamily.value(), 0, &graphicsQueue);
         vkGetDeviceQueue(device, indices.computeFamily.value(), 0, &computeQueue);
         vkGetDeviceQueue(device, indices.presentFamily.value(), 0, &presentQueue);
+
+        graphQueueFamily = indices.computeFamily.value();
+        vkGetDeviceQueue(device, graphQueueFamily, (dedicatedGraphQueue) ? 1 : 0, &graphQueue);
+
+        if (!dedicatedGraphQueue) {
+            JST_DEBUG("[VULKAN] Compute graphs will share the compute queue.");
+        }
     }
 
     // Create descriptor pool.
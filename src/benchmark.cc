@@ -1,6 +1,10 @@
 #include <chrono>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "jetstream/benchmark.hh"
+#include "jetstream/backend/base.hh"
 
 namespace Jetstream {
 
@@ -25,6 +29,92 @@ const Benchmark::ResultMapType& Benchmark::getResults() {
     return results;
 }
 
+void Benchmark::countersBegin() {
+    counters.begin();
+}
+
+void Benchmark::countersEnd(const std::string& name, const U64& calls) {
+    samples[name] = {counters.end(), calls};
+}
+
+void Benchmark::setWorkload(const std::string& name, const U64& bytes, const F64& flops) {
+    workloads[name] = {bytes, flops};
+}
+
+void Benchmark::setAccuracy(const std::string& name, const F64& maxError) {
+    accuracies[name] = maxError;
+}
+
+const Benchmark::Roofline& Benchmark::getRoofline() {
+    using Clock = std::chrono::steady_clock;
+
+    if (roofline.bandwidth_gbps > 0.0) {
+        return roofline;
+    }
+
+    // STREAM triad. The arrays are 64 MB each to stay out of the caches.
+
+    {
+        constexpr U64 Size = 16 * 1024 * 1024;
+
+        std::vector<F32> a(Size, 0.0f);
+        std::vector<F32> b(Size, 1.0f);
+        std::vector<F32> c(Size, 2.0f);
+        const F32 scalar = 3.0f;
+
+        F64 best = std::numeric_limits<F64>::max();
+        for (U64 run = 0; run < 5; run++) {
+            const auto start = Clock::now();
+            for (U64 i = 0; i < Size; i++) {
+                a[i] = b[i] + scalar * c[i];
+            }
+            ankerl::nanobench::doNotOptimizeAway(a.data());
+            best = std::min(best, std::chrono::duration<F64>(Clock::now() - start).count());
+        }
+
+        roofline.bandwidth_gbps = (3.0 * Size * sizeof(F32)) / best / 1e9;
+    }
+
+    // Independent multiply-add chains. Enough accumulators to hide the
+    // latency of the FMA units and fill the widest vector registers.
+
+    {
+        constexpr U64 Lanes = 64;
+        constexpr U64 Iterations = 1 << 18;
+
+        F32 accumulators[Lanes];
+        const F32 multiplier = 0.999999f;
+        const F32 addend = 1e-6f;
+
+        F64 best = std::numeric_limits<F64>::max();
+        for (U64 run = 0; run < 5; run++) {
+            for (U64 l = 0; l < Lanes; l++) {
+                accumulators[l] = static_cast<F32>(l);
+            }
+
+            const auto start = Clock::now();
+            for (U64 i = 0; i < Iterations; i++) {
+                for (U64 l = 0; l < Lanes; l++) {
+                    accumulators[l] = accumulators[l] * multiplier + addend;
+                }
+            }
+            F32 total = 0.0f;
+            for (U64 l = 0; l < Lanes; l++) {
+                total += accumulators[l];
+            }
+            ankerl::nanobench::doNotOptimizeAway(total);
+            best = std::min(best, std::chrono::duration<F64>(Clock::now() - start).count());
+        }
+
+        roofline.peak_gflops = (2.0 * Lanes * Iterations) / best / 1e9;
+    }
+
+    JST_INFO("[BENCHMARK] Machine roofline: {:.2f} GB/s memory bandwidth, {:.2f} GFLOP/s peak (single core).",
+             roofline.bandwidth_gbps, roofline.peak_gflops);
+
+    return roofline;
+}
+
 void Benchmark::add(const std::string& module,
                     const std::string& device, 
                     const std::string& type, 
@@ -45,6 +135,31 @@ void Benchmark::run(const std::string& outputType, std::ostream& out) {
         JST_CHECK_THROW(Result::FATAL);
     }
 
+    // Hardware counters are optional. Containers and VMs usually
+    // don't expose the PMU, in this case the columns are left empty.
+    const bool countersAvailable = (counters.open() == Result::SUCCESS);
+    if (!countersAvailable) {
+        JST_WARN("[BENCHMARK] Hardware performance counters unavailable. Skipping counter metrics.");
+    }
+
+    const auto& machine = getRoofline();
+
+    if (outputType == "markdown") {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        const auto& caps = Backend::CPU::GetCapabilities();
+        out << fmt::format("Processor: {} ({}, {} cores, {} threads)", caps.processorName,
+                                                                      caps.architecture,
+                                                                      caps.physicalCores,
+                                                                      caps.logicalCores) << std::endl;
+        out << fmt::format("ISA: {} | L1d {} KB, L2 {} KB, L3 {} KB", caps.isa(),
+                                                                     caps.l1DataCacheSize / 1024,
+                                                                     caps.l2CacheSize / 1024,
+                                                                     caps.l3CacheSize / 1024) << std::endl;
+#endif
+        out << fmt::format("Machine roofline: {:.2f} GB/s, {:.2f} GFLOP/s (single core)",
+                           machine.bandwidth_gbps, machine.peak_gflops) << std::endl;
+    }
+
     for (auto& [module, benchmark] : benchmarks) {
         using namespace std::chrono_literals;
 
@@ -54,12 +169,17 @@ void Benchmark::run(const std::string& outputType, std::ostream& out) {
              .output(nullptr)
              .timeUnit(1ms, "ms")
              .minEpochTime(100ms)
-             .relative(false);
+             .relative(false)
+             .performanceCounters(false);
 
         if (outputType == "markdown") {
             bench.output(&out);
         }
 
+        samples.clear();
+        workloads.clear();
+        accuracies.clear();
+
         for (auto& [name, benchmark] : benchmark) {
             benchmark(bench, name);
         }
@@ -74,14 +194,94 @@ void Benchmark::run(const std::string& outputType, std::ostream& out) {
             const auto elapsed = result.median(nanobench::Result::Measure::elapsed);
             const auto error = result.medianAbsolutePercentError(nanobench::Result::Measure::elapsed);
 
+            // Counters are taken from the whole run, calibration included.
+            // Nanobench counters stay off so only one group holds the PMU.
+            const auto& name = result.config().mBenchmarkName;
+            const auto [sample, calls] = samples.contains(name) ? samples.at(name) :
+                                                                   std::pair<PerfCounters::Sample, U64>{};
+            const auto cycles = (calls > 0) ? static_cast<F64>(sample.cycles) / calls : 0.0;
+
+            // Kernels without FLOPs are bound by the bandwidth roof only.
+            // Otherwise the attainable performance is the lowest of the
+            // compute roof and the bandwidth roof at this intensity.
+            const auto ops_per_sec = bench.batch() / elapsed;
+            const auto [bytes, flops] = workloads.contains(name) ? workloads.at(name) : std::pair<U64, F64>{0, 0.0};
+            const F64 gbps = bytes * ops_per_sec / 1e9;
+            const F64 gflops = flops * ops_per_sec / 1e9;
+
+            F64 fraction = 0.0;
+            if (flops > 0.0 && bytes > 0) {
+                const F64 intensity = flops / bytes;
+                fraction = gflops / std::min(machine.peak_gflops, intensity * machine.bandwidth_gbps);
+            } else if (bytes > 0) {
+                fraction = gbps / machine.bandwidth_gbps;
+            }
+
             results[module].push_back({
-                .name = result.config().mBenchmarkName,
-                .ops_per_sec = bench.batch() / elapsed,
+                .name = name,
+                .ops_per_sec = ops_per_sec,
                 .ms_per_op = elapsed / bench.batch() * 1000.0f,
                 .error = error,
+                .cycles_per_op = cycles,
+                .ipc = sample.ipc(),
+                .cache_mpki = sample.cacheMissesPerKiloInstruction(),
+                .branch_mpki = sample.branchMissesPerKiloInstruction(),
+                .bytes_per_op = static_cast<F64>(bytes),
+                .flops_per_op = flops,
+                .gbps = gbps,
+                .gflops = gflops,
+                .roofline = fraction,
+                .max_error = accuracies.contains(name) ? accuracies.at(name) : -1.0,
             });
         }
+
+        if (outputType == "markdown") {
+            out << std::endl;
+            out << "|       MB/op |     FLOP/B |       GB/s |    GFLOP/s |    Roof % | " << module << std::endl;
+            out << "|------------:|-----------:|-----------:|-----------:|----------:|:----------" << std::endl;
+            for (const auto& entry : results[module]) {
+                const F64 intensity = (entry.bytes_per_op > 0.0) ? entry.flops_per_op / entry.bytes_per_op : 0.0;
+                out << fmt::format("| {:>11.2f} | {:>10.3f} | {:>10.2f} | {:>10.2f} | {:>9.1f} | `{}`", entry.bytes_per_op / 1e6,
+                                                                                                    intensity,
+                                                                                                    entry.gbps,
+                                                                                                    entry.gflops,
+                                                                                                    entry.roofline * 100.0,
+                                                                                                    entry.name) << std::endl;
+            }
+        }
+
+        const bool hasAccuracy = std::ranges::any_of(results[module], [](const auto& entry) {
+            return entry.max_error >= 0.0;
+        });
+
+        if (outputType == "markdown" && hasAccuracy) {
+            out << std::endl;
+            out << "|        op/s |    Max Error | " << module << std::endl;
+            out << "|------------:|-------------:|:----------" << std::endl;
+            for (const auto& entry : results[module]) {
+                if (entry.max_error < 0.0) {
+                    continue;
+                }
+                out << fmt::format("| {:>11.3g} | {:>12.2e} | `{}`", entry.ops_per_sec,
+                                                                   entry.max_error,
+                                                                   entry.name) << std::endl;
+            }
+        }
+
+        if (outputType == "markdown" && countersAvailable) {
+            out << std::endl;
+            out << "|          IPC |     LLC MPKI |  Branch MPKI | " << module << std::endl;
+            out << "|-------------:|-------------:|-------------:|:----------" << std::endl;
+            for (const auto& entry : results[module]) {
+                out << fmt::format("| {:>12.2f} | {:>12.2f} | {:>12.2f} | `{}`", entry.ipc,
+                                                                                entry.cache_mpki,
+                                                                                entry.branch_mpki,
+                                                                                entry.name) << std::endl;
+            }
+        }
     }
+
+    counters.close();
 }
 
 }  // namespace Jetstream
\ No newline at end of file
@@ -115,6 +115,10 @@ Result Compositor::refreshState() {
         state.id = id;
         nodeLocaleMap[id++] = locale;
 
+        // Invalidate layout cache.
+        state.titleScalingFactor = 0.0f;
+        state.nodePosSynced = false;
+
         // Cleanup and create pin map and convert locale to interface locale.
 
         state.inputs.clear();
@@ -153,6 +157,7 @@ Result Compositor::refreshState() {
 
     // Create link and edges.
     linkLocaleMap.clear();
+    linkStates.clear();
 
     U64 linkId = 0;
     for (auto& [locale, state] : nodeStates) {
@@ -169,11 +174,19 @@ Result Compositor::refreshState() {
             for (const auto& inputLocale : outputInputCache[outputLocale]) {
                 state.edges.insert(nodeStates.at(inputLocale.block()).id);
 
+                linkStates.push_back({
+                    linkId,
+                    inputLocalePinMap.at(inputLocale),
+                    outputLocalePinMap.at(outputLocale),
+                    state.block,
+                });
                 linkLocaleMap[linkId++] = {inputLocale, outputLocale};
             }
         }
     }
 
+    stateChanged.test_and_set();
+
     return Result::SUCCESS;
 }
 
@@ -428,6 +441,8 @@ Result Compositor::draw() {
     interfaceHalt.wait(true);
     interfaceHalt.test_and_set();
 
+    stateChanged.clear();
+
     JST_CHECK(drawStatic());
     JST_CHECK(drawGraph());
 
@@ -1183,12 +1198,66 @@ Result Compositor::drawStatic() {
             ImGui::TableSetupColumn("Variable", ImGuiTableColumnFlags_WidthFixed, variableWidth);
             ImGui::TableSetupColumn("Info", ImGuiTableColumnFlags_WidthStretch);
 
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("Profiler:");
+            ImGui::TableSetColumnIndex(1);
+            bool profiling = instance.scheduler().isProfiling();
+            if (ImGui::Checkbox("##SchedulerProfiling", &profiling)) {
+                instance.scheduler().setProfiling(profiling);
+            }
+
             instance.scheduler().drawDebugMessage();
 
             ImGui::EndTable();
             ImGui::TreePop();
         }
 
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        if (ImGui::TreeNodeEx("Processor")) {
+            const auto& caps = Backend::CPU::GetCapabilities();
+
+            ImGui::BeginTable("##InfoTableProcessor", 2, ImGuiTableFlags_None);
+            ImGui::TableSetupColumn("Variable", ImGuiTableColumnFlags_WidthFixed, variableWidth);
+            ImGui::TableSetupColumn("Info", ImGuiTableColumnFlags_WidthStretch);
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("Name:");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{}", caps.processorName);
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("Topology:");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{} cores, {} threads ({})", caps.physicalCores, caps.logicalCores, caps.architecture);
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("ISA:");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextWrapped("%s", caps.isa().c_str());
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("Caches:");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("L1d {} KB / L2 {} KB / L3 {} MB", caps.l1DataCacheSize / 1024,
+                                                                     caps.l2CacheSize / 1024,
+                                                                     caps.l3CacheSize / (1024 * 1024));
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("Workers:");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{}", Backend::State<Device::CPU>()->getWorkerCount());
+
+            ImGui::EndTable();
+            ImGui::TreePop();
+        }
+#endif
+
         ImGui::Dummy(ImVec2(variableWidth * 2.3f, 0.0f));
 
         ImGui::End();
@@ -1878,11 +1947,15 @@ Result Compositor::drawStatic() {
                                                              ImGuiTableFlags_Hideable;
 
                     ImGui::TableNextColumn();
-                    if (ImGui::BeginTable(("benchmark-subtable-" + name).c_str(), 4, nestedTableFlags)) {
-                        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.60f);
-                        ImGui::TableSetupColumn("ms/op", ImGuiTableColumnFlags_WidthStretch, 0.10f);
-                        ImGui::TableSetupColumn("op/s", ImGuiTableColumnFlags_WidthStretch, 0.20f);
-                        ImGui::TableSetupColumn("err%", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                    if (ImGui::BeginTable(("benchmark-subtable-" + name).c_str(), 8, nestedTableFlags)) {
+                        ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.40f);
+                        ImGui::TableSetupColumn("ms/op", ImGuiTableColumnFlags_WidthStretch, 0.08f);
+                        ImGui::TableSetupColumn("op/s", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+                        ImGui::TableSetupColumn("err%", ImGuiTableColumnFlags_WidthStretch, 0.06f);
+                        ImGui::TableSetupColumn("IPC", ImGuiTableColumnFlags_WidthStretch, 0.06f);
+                        ImGui::TableSetupColumn("LLC MPKI", ImGuiTableColumnFlags_WidthStretch, 0.08f);
+                        ImGui::TableSetupColumn("GB/s", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                        ImGui::TableSetupColumn("Roof%", ImGuiTableColumnFlags_WidthStretch, 0.10f);
                         ImGui::TableHeadersRow();
 
                         for (const auto& entry : entries) {
@@ -1895,6 +1968,14 @@ Result Compositor::drawStatic() {
                             ImGui::Text("%.2f", entry.ops_per_sec);
                             ImGui::TableNextColumn();
                             ImGui::Text("%.2f", entry.error);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.ipc);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.cache_mpki);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.gbps);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.1f", entry.roofline * 100.0);
                         }
 
                         ImGui::EndTable();
@@ -2030,26 +2111,43 @@ Result Compositor::drawGraph() {
             return;
         }
 
-        // Set node position according to the internal state.
-        for (const auto& [locale, state] : nodeStates) {
-            const auto& [x, y] = state.block->getState().nodePos;
-            ImNodes::SetNodeGridSpacePos(state.id, ImVec2(x, y));
+        // Set node position according to the internal state. Only nodes
+        // moved outside of the editor need to be updated.
+        for (auto& [locale, state] : nodeStates) {
+            const auto& nodePos = state.block->getState().nodePos;
+            if (!state.nodePosSynced || state.nodePos != nodePos) {
+                ImNodes::SetNodeGridSpacePos(state.id, ImVec2(nodePos.width, nodePos.height));
+                state.nodePos = nodePos;
+                state.nodePosSynced = true;
+            }
         }
 
         ImNodes::BeginNodeEditor();
         ImNodes::MiniMap(0.075f * scalingFactor, ImNodesMiniMapLocation_TopRight);
 
-        for (const auto& [locale, state] : nodeStates) {
+        for (auto& [locale, state] : nodeStates) {
             const auto& block = state.block;
             const auto& moduleEntry = Store::BlockMetadataList().at(block->id());
 
-            F32& nodeWidth = block->state.nodeWidth;
-            const F32 titleWidth = ImGui::CalcTextSize(state.title.c_str()).x +
+            // Title width only changes with the block status or scale.
+            const bool complete = block->complete();
+            const bool warning = !block->warning().empty();
+            if (state.titleScalingFactor != scalingFactor ||
+                state.titleComplete != complete ||
+                state.titleWarning != warning) {
+                state.titleWidth = ImGui::CalcTextSize(state.title.c_str()).x +
                                    ImGui::CalcTextSize(" " ICON_FA_CIRCLE_QUESTION).x +
-                                   ((!block->complete()) ? 
+                                   ((!complete) ? 
                                         ImGui::CalcTextSize(" " ICON_FA_SKULL).x : 0) +
-                                   ((!block->warning().empty() && block->complete()) ? 
+                                   ((warning && complete) ? 
                                         ImGui::CalcTextSize(" " ICON_FA_TRIANGLE_EXCLAMATION).x : 0);
+                state.titleScalingFactor = scalingFactor;
+                state.titleComplete = complete;
+                state.titleWarning = warning;
+            }
+
+            F32& nodeWidth = block->state.nodeWidth;
+            const F32& titleWidth = state.titleWidth;
             const F32 controlWidth = block->shouldDrawControl() ? windowMinWidth: 0.0f;
             const F32 previewWidth = block->shouldDrawPreview() ? windowMinWidth : 0.0f;
             nodeWidth = std::max({titleWidth, nodeWidth, controlWidth, previewWidth});
@@ -2297,11 +2395,7 @@ Result Compositor::drawGraph() {
         }
 
         // Draw node links.
-        for (const auto& [linkId, locales] : linkLocaleMap) {
-            const auto& [inputLocale, outputLocale] = locales;
-            const auto& inputPinId = inputLocalePinMap.at(inputLocale);
-            const auto& outputPinId = outputLocalePinMap.at(outputLocale);
-            const auto& outputBlock = nodeStates.at(outputLocale.block()).block;
+        for (const auto& [linkId, inputPinId, outputPinId, outputBlock] : linkStates) {
 
             if (outputBlock->complete()) {
                 switch (outputBlock->device()) {
@@ -2408,9 +2502,10 @@ Result Compositor::drawGraph() {
         }
 
         // Update internal state node position.
-        for (const auto& [locale, state] : nodeStates) {
+        for (auto& [locale, state] : nodeStates) {
             const auto& [x, y] = ImNodes::GetNodeGridSpacePos(state.id);
             state.block->state.nodePos = {x, y};
+            state.nodePos = {x, y};
         }
 
         // Render underlying buffer information about the link.
@@ -22,6 +22,15 @@ Result CPU::computeReady() {
 }
 
 Result CPU::compute() {
+    if (isProfiling()) {
+        for (U64 i = 0; i < blocks.size(); i++) {
+            profileBegin();
+            JST_CHECK(blocks[i]->compute(*metadata));
+            profileEnd(i);
+        }
+        return Result::SUCCESS;
+    }
+
     for (const auto& block : blocks) { 
         JST_CHECK(block->compute(*metadata));
     }
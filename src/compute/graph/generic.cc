@@ -22,9 +22,54 @@ Result Graph::setExternallyWiredOutput(const U64& output) {
     return Result::SUCCESS;
 }
 
-Result Graph::setModule(const std::shared_ptr<Compute>& block) {
+Result Graph::setModule(const std::shared_ptr<Compute>& block, const std::string& name) {
     blocks.push_back(block);
+    profile.push_back(std::make_unique<ProfileEntry>());
+    profile.back()->name = name;
     return Result::SUCCESS;
 }
 
+// Counters only measure the thread that opened them. Graphs of NUMA clusters
+// are computed by pool workers, so each thread keeps its own group.
+
+static PerfCounters& ThreadCounters() {
+    thread_local PerfCounters counters;
+    thread_local bool opened = false;
+
+    if (!opened) {
+        opened = true;
+        counters.open();
+    }
+
+    return counters;
+}
+
+void Graph::profileBegin() {
+    ThreadCounters().begin();
+    profileStart = std::chrono::steady_clock::now();
+}
+
+void Graph::profileEnd(const U64& index) {
+    const auto elapsed = std::chrono::steady_clock::now() - profileStart;
+    auto& counters = ThreadCounters();
+    const auto sample = counters.end();
+
+    auto& entry = *profile[index];
+    const F64 ms = std::chrono::duration<F64, std::milli>(elapsed).count();
+
+    // Exponential moving average to keep the readings stable.
+    constexpr F64 alpha = 0.05;
+    const auto smooth = [&](std::atomic<F64>& value, const F64& current) {
+        const F64 previous = value.load(std::memory_order_relaxed);
+        value.store((previous == 0.0) ? current : previous + alpha * (current - previous),
+                    std::memory_order_relaxed);
+    };
+
+    smooth(entry.msPerCompute, ms);
+    if (counters.available()) {
+        smooth(entry.ipc, sample.ipc());
+        smooth(entry.cacheMissesPerKiloInstruction, sample.cacheMissesPerKiloInstruction());
+    }
+}
+
 }  // namespace Jetstream
\ No newline at end of file
@@ -0,0 +1,646 @@
+#include <mutex>
+#include <algorithm>
+
+#include <glslang/Include/glslang_c_interface.h>
+#include <glslang/Public/resource_limits_c.h>
+
+#include "jetstream/compute/graph/vulkan.hh"
+#include "jetstream/backend/devices/vulkan/helpers.hh"
+
+namespace Jetstream {
+
+// Keeps every staged region within the copy offset alignment of any device.
+static U64 StagingAligned(const U64& size) {
+    return (size + 255) & ~static_cast<U64>(255);
+}
+
+Vulkan::Vulkan() {
+    JST_DEBUG("Creating new Vulkan compute graph.");
+    metadata = std::make_shared<RuntimeMetadata>();
+
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& device = backend->getDevice();
+    auto& runtime = metadata->vulkan;
+
+    runtime.queue = backend->getGraphQueue();
+
+    // Each graph records into its own command buffers.
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = backend->getGraphQueueFamily();
+
+    JST_VK_CHECK_THROW(vkCreateCommandPool(device, &poolInfo, nullptr, &runtime.commandPool), [&]{
+        JST_ERROR("[VULKAN] Can't create graph command pool.");
+    });
+
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    for (auto& slot : slots) {
+        VkCommandBufferAllocateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        bufferInfo.commandPool = runtime.commandPool;
+        bufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        bufferInfo.commandBufferCount = 1;
+
+        JST_VK_CHECK_THROW(vkAllocateCommandBuffers(device, &bufferInfo, &slot.commandBuffer), [&]{
+            JST_ERROR("[VULKAN] Can't allocate graph command buffer.");
+        });
+
+        JST_VK_CHECK_THROW(vkCreateFence(device, &fenceInfo, nullptr, &slot.fence), [&]{
+            JST_ERROR("[VULKAN] Can't create graph fence.");
+        });
+    }
+
+    // Used by the blocks for one-off submissions during creation.
+
+    JST_VK_CHECK_THROW(vkCreateFence(device, &fenceInfo, nullptr, &runtime.fence), [&]{
+        JST_ERROR("[VULKAN] Can't create graph fence.");
+    });
+
+    runtime.commandBuffer = slots[currentSlot].commandBuffer;
+}
+
+Vulkan::~Vulkan() {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+    auto& runtime = metadata->vulkan;
+
+    for (auto& slot : slots) {
+        if (slot.pending) {
+            vkWaitForFences(device, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+        }
+        vkDestroyFence(device, slot.fence, nullptr);
+        vkFreeCommandBuffers(device, runtime.commandPool, 1, &slot.commandBuffer);
+    }
+
+    destroyStaging();
+
+    vkDestroyFence(device, runtime.fence, nullptr);
+    vkDestroyCommandPool(device, runtime.commandPool, nullptr);
+}
+
+Result Vulkan::create() {
+    JST_CHECK(createStaging());
+
+    for (const auto& block : blocks) {
+        JST_CHECK(block->createCompute(*metadata));
+    }
+    return Result::SUCCESS;
+}
+
+Result Vulkan::computeReady() {
+    for (const auto& block : blocks) {
+        JST_CHECK(block->computeReady());
+    }
+    return Result::SUCCESS;
+}
+
+Result Vulkan::compute() {
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& runtime = metadata->vulkan;
+    auto& slot = slots[currentSlot];
+
+    // Wait for the frame that last used this slot.
+
+    if (slot.pending) {
+        JST_CHECK(complete(slot));
+    }
+
+    runtime.commandBuffer = slot.commandBuffer;
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    JST_VK_CHECK(vkBeginCommandBuffer(slot.commandBuffer, &beginInfo), [&]{
+        JST_ERROR("[VULKAN] Failed to begin graph command buffer.");
+    });
+
+    // The other slot might still be downloading the device buffers the
+    // shaders of this frame are about to overwrite.
+
+    {
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    // Upload host inputs through this slot of the staging buffer.
+
+    const U64 slotOffset = currentSlot * stagingSlotSize;
+    U64 offset = 0;
+
+    if (!uploads.empty()) {
+        // The previous frame might still be reading the device buffers.
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    for (const auto& transfer : uploads) {
+        memcpy(stagingMappedMemory + slotOffset + offset, transfer.source, transfer.sizeBytes);
+
+        VkBufferCopy region = {};
+        region.srcOffset = slotOffset + offset;
+        region.dstOffset = 0;
+        region.size = transfer.sizeBytes;
+
+        vkCmdCopyBuffer(slot.commandBuffer, stagingBuffer, static_cast<VkBuffer>(transfer.target), 1, &region);
+
+        offset += StagingAligned(transfer.sizeBytes);
+    }
+
+    if (!uploads.empty()) {
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    for (const auto& block : blocks) {
+        JST_CHECK(block->compute(*metadata));
+    }
+
+    // Download outputs consumed by the host into this slot of the staging buffer.
+
+    if (!downloads.empty()) {
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    for (const auto& transfer : downloads) {
+        VkBufferCopy region = {};
+        region.srcOffset = 0;
+        region.dstOffset = slotOffset + offset;
+        region.size = transfer.sizeBytes;
+
+        vkCmdCopyBuffer(slot.commandBuffer, static_cast<VkBuffer>(transfer.source), stagingBuffer, 1, &region);
+
+        offset += StagingAligned(transfer.sizeBytes);
+    }
+
+    if (!downloads.empty()) {
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_HOST_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    JST_VK_CHECK(vkEndCommandBuffer(slot.commandBuffer), [&]{
+        JST_ERROR("[VULKAN] Failed to end graph command buffer.");
+    });
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &slot.commandBuffer;
+
+    {
+        std::lock_guard<std::mutex> lock(backend->getQueueMutex());
+        JST_VK_CHECK(vkQueueSubmit(runtime.queue, 1, &submitInfo, slot.fence), [&]{
+            JST_ERROR("[VULKAN] Can't submit graph command buffer.");
+        });
+    }
+
+    // Don't wait. The next frame is recorded into the other slot while
+    // the device works on this one.
+
+    slot.pending = true;
+    slot.sequence = ++sequence;
+    currentSlot = (currentSlot + 1) % NumberOfSlots;
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::synchronize() {
+    // Complete the oldest frame first so the newest downloads win.
+    std::array<Slot*, NumberOfSlots> order;
+    for (U64 i = 0; i < NumberOfSlots; i++) {
+        order[i] = &slots[i];
+    }
+    std::ranges::sort(order, {}, &Slot::sequence);
+
+    for (auto* slot : order) {
+        if (slot->pending) {
+            JST_CHECK(complete(*slot));
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::complete(Slot& slot) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    JST_VK_CHECK(vkWaitForFences(device, 1, &slot.fence, VK_TRUE, UINT64_MAX), [&]{
+        JST_ERROR("[VULKAN] Failed to wait for graph fence.");
+    });
+    vkResetFences(device, 1, &slot.fence);
+    vkResetCommandBuffer(slot.commandBuffer, 0);
+
+    slot.pending = false;
+
+    // Copy the downloads of this frame back to the host buffers.
+
+    U64 offset = (&slot - slots.data()) * stagingSlotSize;
+    for (const auto& transfer : uploads) {
+        offset += StagingAligned(transfer.sizeBytes);
+    }
+
+    for (const auto& transfer : downloads) {
+        memcpy(transfer.target, stagingMappedMemory + offset, transfer.sizeBytes);
+        offset += StagingAligned(transfer.sizeBytes);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::destroy() {
+    JST_CHECK(synchronize());
+
+    for (const auto& block : blocks) {
+        JST_CHECK(block->destroyCompute(*metadata));
+    }
+    blocks.clear();
+
+    uploads.clear();
+    downloads.clear();
+    JST_CHECK(destroyStaging());
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::addTransfer(const Transfer& transfer) {
+    if (transfer.device == Device::CPU) {
+        JST_TRACE("[VULKAN] Adding upload of {} bytes.", transfer.sizeBytes);
+        uploads.push_back(transfer);
+        return Result::SUCCESS;
+    }
+
+    if (transfer.device == Device::Vulkan) {
+        JST_TRACE("[VULKAN] Adding download of {} bytes.", transfer.sizeBytes);
+        downloads.push_back(transfer);
+        return Result::SUCCESS;
+    }
+
+    JST_ERROR("[VULKAN] Can't transfer memory from device {}.", transfer.device);
+    return Result::ERROR;
+}
+
+Result Vulkan::rebindTransfers(const void* previous, void* current) {
+    for (auto& transfer : uploads) {
+        if (transfer.source == previous) {
+            transfer.source = current;
+        }
+    }
+
+    for (auto& transfer : downloads) {
+        if (transfer.target == previous) {
+            transfer.target = current;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::createStaging() {
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& device = backend->getDevice();
+    auto& physicalDevice = backend->getPhysicalDevice();
+
+    stagingSlotSize = 0;
+    for (const auto& transfer : uploads) {
+        stagingSlotSize += StagingAligned(transfer.sizeBytes);
+    }
+    for (const auto& transfer : downloads) {
+        stagingSlotSize += StagingAligned(transfer.sizeBytes);
+    }
+
+    if (stagingSlotSize == 0) {
+        return Result::SUCCESS;
+    }
+
+    const U64 stagingSize = stagingSlotSize * NumberOfSlots;
+
+    if (stagingSize > backend->getStagingBufferSize()) {
+        JST_ERROR("[VULKAN] Graph transfers need {:.2f} MB of staging memory but the limit is {:.2f} MB.",
+                  static_cast<F32>(stagingSize) / JST_MB,
+                  static_cast<F32>(backend->getStagingBufferSize()) / JST_MB);
+        return Result::ERROR;
+    }
+
+    JST_DEBUG("[VULKAN] Allocating {:.2f} MB of graph staging memory.", static_cast<F32>(stagingSize) / JST_MB);
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = stagingSize;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                       VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    JST_VK_CHECK(vkCreateBuffer(device, &bufferInfo, nullptr, &stagingBuffer), [&]{
+        JST_ERROR("[VULKAN] Failed to create graph staging buffer.");
+    });
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(device, stagingBuffer, &memoryRequirements);
+
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memoryRequirements.size;
+    allocInfo.memoryTypeIndex = Backend::FindMemoryType(physicalDevice,
+                                                        memoryRequirements.memoryTypeBits,
+                                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    JST_VK_CHECK(vkAllocateMemory(device, &allocInfo, nullptr, &stagingMemory), [&]{
+        JST_ERROR("[VULKAN] Failed to allocate graph staging memory.");
+    });
+
+    JST_VK_CHECK(vkBindBufferMemory(device, stagingBuffer, stagingMemory, 0), [&]{
+        JST_ERROR("[VULKAN] Failed to bind graph staging memory.");
+    });
+
+    void* mappedMemory = nullptr;
+    JST_VK_CHECK(vkMapMemory(device, stagingMemory, 0, stagingSize, 0, &mappedMemory), [&]{
+        JST_ERROR("[VULKAN] Failed to map graph staging memory.");
+    });
+    stagingMappedMemory = static_cast<U8*>(mappedMemory);
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::destroyStaging() {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    if (stagingMemory != VK_NULL_HANDLE) {
+        vkUnmapMemory(device, stagingMemory);
+        vkFreeMemory(device, stagingMemory, nullptr);
+    }
+    if (stagingBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, stagingBuffer, nullptr);
+    }
+
+    stagingBuffer = VK_NULL_HANDLE;
+    stagingMemory = VK_NULL_HANDLE;
+    stagingMappedMemory = nullptr;
+    stagingSlotSize = 0;
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::CompileKernel(const char* shaderSrc,
+                             const U64& numberOfBuffers,
+                             const U64& pushConstantsSize,
+                             Kernel& kernel) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    kernel.numberOfBuffers = numberOfBuffers;
+    kernel.pushConstantsSize = pushConstantsSize;
+
+    // Compile GLSL to SPIR-V.
+
+    static std::once_flag glslangInitialized;
+    std::call_once(glslangInitialized, []{
+        glslang_initialize_process();
+    });
+
+    glslang_input_t input = {};
+    input.language = GLSLANG_SOURCE_GLSL;
+    input.stage = GLSLANG_STAGE_COMPUTE;
+    input.client = GLSLANG_CLIENT_VULKAN;
+    input.client_version = GLSLANG_TARGET_VULKAN_1_1;
+    input.target_language = GLSLANG_TARGET_SPV;
+    input.target_language_version = GLSLANG_TARGET_SPV_1_3;
+    input.code = shaderSrc;
+    input.default_version = 450;
+    input.default_profile = GLSLANG_NO_PROFILE;
+    input.messages = GLSLANG_MSG_DEFAULT_BIT;
+    input.resource = glslang_default_resource();
+
+    glslang_shader_t* shader = glslang_shader_create(&input);
+
+    if (!glslang_shader_preprocess(shader, &input) || !glslang_shader_parse(shader, &input)) {
+        JST_ERROR("Error while compiling kernel:\n{}", glslang_shader_get_info_log(shader));
+        glslang_shader_delete(shader);
+        return Result::ERROR;
+    }
+
+    glslang_program_t* program = glslang_program_create();
+    glslang_program_add_shader(program, shader);
+
+    if (!glslang_program_link(program, GLSLANG_MSG_SPV_RULES_BIT | GLSLANG_MSG_VULKAN_RULES_BIT)) {
+        JST_ERROR("Error while linking kernel:\n{}", glslang_program_get_info_log(program));
+        glslang_program_delete(program);
+        glslang_shader_delete(shader);
+        return Result::ERROR;
+    }
+
+    glslang_program_SPIRV_generate(program, GLSLANG_STAGE_COMPUTE);
+
+    std::vector<U32> spirv(glslang_program_SPIRV_get_size(program));
+    glslang_program_SPIRV_get(program, spirv.data());
+
+    glslang_program_delete(program);
+    glslang_shader_delete(shader);
+
+    // Create shader module.
+
+    VkShaderModuleCreateInfo moduleInfo = {};
+    moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    moduleInfo.codeSize = spirv.size() * sizeof(U32);
+    moduleInfo.pCode = spirv.data();
+
+    JST_VK_CHECK(vkCreateShaderModule(device, &moduleInfo, nullptr, &kernel.shaderModule), [&]{
+        JST_ERROR("[VULKAN] Can't create kernel shader module.");
+    });
+
+    // Create descriptor set layout.
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings(numberOfBuffers);
+    for (U64 i = 0; i < numberOfBuffers; i++) {
+        bindings[i] = {};
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = bindings.size();
+    layoutInfo.pBindings = bindings.data();
+
+    JST_VK_CHECK(vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &kernel.descriptorSetLayout), [&]{
+        JST_ERROR("[VULKAN] Can't create kernel descriptor set layout.");
+        DestroyKernel(kernel);
+    });
+
+    // Create pipeline layout.
+
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = pushConstantsSize;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &kernel.descriptorSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = (pushConstantsSize > 0) ? 1 : 0;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    JST_VK_CHECK(vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &kernel.pipelineLayout), [&]{
+        JST_ERROR("[VULKAN] Can't create kernel pipeline layout.");
+        DestroyKernel(kernel);
+    });
+
+    // Create compute pipeline.
+
+    VkComputePipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = kernel.shaderModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = kernel.pipelineLayout;
+
+    JST_VK_CHECK(vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &kernel.pipeline), [&]{
+        JST_ERROR("[VULKAN] Can't create kernel compute pipeline.");
+        DestroyKernel(kernel);
+    });
+
+    // Allocate descriptor set.
+
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = Backend::State<Device::Vulkan>()->getDescriptorPool();
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &kernel.descriptorSetLayout;
+
+    JST_VK_CHECK(vkAllocateDescriptorSets(device, &allocInfo, &kernel.descriptorSet), [&]{
+        JST_ERROR("[VULKAN] Can't allocate kernel descriptor set.");
+        DestroyKernel(kernel);
+    });
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::BindBuffers(Kernel& kernel, const std::vector<VkBuffer>& buffers) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+
+    if (buffers.size() != kernel.numberOfBuffers) {
+        JST_ERROR("[VULKAN] Kernel expects {} buffers but {} were bound.", kernel.numberOfBuffers, buffers.size());
+        return Result::ERROR;
+    }
+
+    std::vector<VkDescriptorBufferInfo> bufferInfos(buffers.size());
+    std::vector<VkWriteDescriptorSet> writes(buffers.size());
+
+    for (U64 i = 0; i < buffers.size(); i++) {
+        bufferInfos[i].buffer = buffers[i];
+        bufferInfos[i].offset = 0;
+        bufferInfos[i].range = VK_WHOLE_SIZE;
+
+        writes[i] = {};
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = kernel.descriptorSet;
+        writes[i].dstBinding = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = &bufferInfos[i];
+    }
+
+    vkUpdateDescriptorSets(device, writes.size(), writes.data(), 0, nullptr);
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::dispatch(const RuntimeMetadata& meta,
+                        const Kernel& kernel,
+                        const void* constants,
+                        const U64& constantsSize,
+                        const U64& numberOfThreads) {
+    const auto& commandBuffer = meta.vulkan.commandBuffer;
+
+    if (constantsSize != kernel.pushConstantsSize) {
+        JST_ERROR("[VULKAN] Kernel expects {} bytes of push constants but got {}.", kernel.pushConstantsSize,
+                                                                                   constantsSize);
+        return Result::ERROR;
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, kernel.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, kernel.pipelineLayout,
+                            0, 1, &kernel.descriptorSet, 0, nullptr);
+
+    if (constantsSize > 0) {
+        vkCmdPushConstants(commandBuffer, kernel.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, constantsSize, constants);
+    }
+
+    vkCmdDispatch(commandBuffer, (numberOfThreads + LocalSize - 1) / LocalSize, 1, 1);
+
+    // Make the results visible to the next kernel of the graph.
+
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+    vkCmdPipelineBarrier(commandBuffer,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    return Result::SUCCESS;
+}
+
+Result Vulkan::DestroyKernel(Kernel& kernel) {
+    auto& backend = Backend::State<Device::Vulkan>();
+    auto& device = backend->getDevice();
+
+    if (kernel.descriptorSet != VK_NULL_HANDLE) {
+        vkFreeDescriptorSets(device, backend->getDescriptorPool(), 1, &kernel.descriptorSet);
+    }
+    vkDestroyPipeline(device, kernel.pipeline, nullptr);
+    vkDestroyPipelineLayout(device, kernel.pipelineLayout, nullptr);
+    vkDestroyDescriptorSetLayout(device, kernel.descriptorSetLayout, nullptr);
+    vkDestroyShaderModule(device, kernel.shaderModule, nullptr);
+
+    kernel = {};
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
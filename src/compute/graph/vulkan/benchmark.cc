@@ -0,0 +1,69 @@
+#include "jetstream/benchmark.hh"
+#include "jetstream/compute/graph/base.hh"
+#include "jetstream/modules/multiply.hh"
+
+namespace Jetstream {
+
+#if defined(JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_MULTIPLY_VULKAN_AVAILABLE)
+
+// CPU multiply feeding a Vulkan multiply through a staged upload. The
+// overlapped run lets the CPU work on frame i+1 while the device is still
+// busy with frame i. The synchronous run waits for the device every frame.
+
+static void BenchmarkStagedTransfer(ankerl::nanobench::Bench& bench, std::string name) {
+    const auto run = [&](const std::string& mode, const bool& overlap) {
+        Tensor<Device::CPU, CF32> factorA({128, 8000});
+        Tensor<Device::CPU, CF32> factorB({128, 8000});
+
+        auto hostMultiply = std::make_shared<Multiply<Device::CPU, CF32>>();
+        hostMultiply->init_benchmark_mode({}, { .factorA = factorA, .factorB = factorB });
+        hostMultiply->create();
+
+        const auto& product = hostMultiply->getOutputProduct();
+        Tensor<Device::Vulkan, CF32> staged(product);
+
+        auto deviceMultiply = std::make_shared<Multiply<Device::Vulkan, CF32>>();
+        deviceMultiply->init_benchmark_mode({}, { .factorA = staged, .factorB = staged });
+        deviceMultiply->create();
+
+        auto hostGraph = NewGraph(Device::CPU);
+        hostGraph->setModule(hostMultiply);
+        hostGraph->create();
+
+        auto deviceGraph = NewGraph(Device::Vulkan);
+        deviceGraph->setModule(deviceMultiply);
+        deviceGraph->addTransfer({
+            .device = Device::CPU,
+            .source = const_cast<CF32*>(product.data()),
+            .target = staged.data(),
+            .sizeBytes = product.size_bytes(),
+        });
+        deviceGraph->create();
+
+        bench.run(name + mode, [&] {
+            hostGraph->compute();
+            deviceGraph->compute();
+            if (!overlap) {
+                deviceGraph->synchronize();
+            }
+        });
+
+        hostGraph->destroy();
+        deviceGraph->destroy();
+        hostMultiply->destroy();
+        deviceMultiply->destroy();
+    };
+
+    run("128x8000 Overlapped", true);
+    run("128x8000 Synchronous", false);
+}
+
+static bool StagedTransferBenchmark __attribute__((used)) = []() -> bool {
+    Benchmark::Add("StagedTransfer", "Vulkan", "CF32", BenchmarkStagedTransfer);
+    return true;
+}();
+
+#endif
+
+}  // namespace Jetstream
@@ -14,6 +14,10 @@ namespace Jetstream {
 // 8. Calculate and assign Externally Wired Vectors to Graph.
 //    - Externally Wired: When a Vector is connected with another graph.
 // 9. Assert that an In-Place Module is not sharing a branched input Vector.
+//    - Copy-on-write Vectors with a branched source are marked as shared.
+// 10. Insert explicit transfers for Vectors staged between devices.
+// 11. Place CPU outputs inside the output of the module gathering them.
+//    - Placed: When the producer writes directly into its consumer's output.
 
 // TODO: Automatically add copy module if in-place check fails.
 // TODO: Redo PHash logic with locale.
@@ -88,6 +92,7 @@ Result Scheduler::addModule(const Locale& locale,
             presentModuleStates[locale.shash()].module = present;
             presentModuleStates[locale.shash()].inputMap = inputMap;
             presentModuleStates[locale.shash()].outputMap = outputMap;
+            presentModuleStates[locale.shash()].latency = Latency::Tracker(locale.shash());
         }
         if (compute) {
             computeModuleStates[locale.shash()].module = compute;
@@ -172,6 +177,18 @@ Result Scheduler::destroy() {
         executionOrder.clear();
         deviceExecutionOrder.clear();
         graphs.clear();
+        graphDependencies.clear();
+        numaClusters.clear();
+
+        // Return the private copies and hand the pooled blocks back to the system.
+        for (const auto& cow : copyOnWriteVectors) {
+            cow->release();
+        }
+        copyOnWriteVectors.clear();
+        TensorPool::Trim();
+
+        computeBlocksGauge.set(0);
+        presentBlocksGauge.set(0);
 
         return Result::SUCCESS;
     }));
@@ -212,33 +229,140 @@ Result Scheduler::compute() {
         computeWait.notify_all();
     }
 
+    const Result res = computeFrame();
+
+    if (res == Result::SUCCESS) {
+        computeFramesCounter.increment();
+        return res;
+    }
+
+    if (res == Result::TIMEOUT ||
+        res == Result::SKIP) {
+        skippedFramesCounter.increment();
+        JST_WARN("[SCHEDULER] Graph underrun. Skipping frame.");
+        return Result::SUCCESS;
+    }
+
+    JST_FATAL("SCHEDULER] Fatal error code: {}", static_cast<uint8_t>(res));
+    return res;
+}
+
+Result Scheduler::step() {
+    // Return early if the compute pipeline is empty.
+    if (graphs.empty()) {
+        return Result::SUCCESS;
+    }
+
+    // The graph is being rebuilt. Let the caller try again.
+    if (computeHalt.test()) {
+        return Result::SKIP;
+    }
+
+    // Check readiness once instead of spinning on it.
     Result res = Result::SUCCESS;
     {
-        std::unique_lock<std::mutex> lock(sharedMutex);
-        computeCond.wait(lock, [&] { return !presentSync; });
-        computeSync = true;
+        computeWait.test_and_set();
 
-        for (const auto& graph : graphs) {
-            if ((res = graph->compute()) != Result::SUCCESS) {
-                break;
-            }
+        for (U64 i = 0; i < graphs.size() && res == Result::SUCCESS; i++) {
+            res = graphs[i]->computeReady();
         }
 
-        computeSync = false;
+        computeWait.clear();
+        computeWait.notify_all();
+    }
+
+    if (res == Result::SUCCESS) {
+        res = computeFrame();
+    }
+
+    // Outputs should be readable when this returns.
+    for (U64 i = 0; i < graphs.size() && res == Result::SUCCESS; i++) {
+        res = graphs[i]->synchronize();
     }
-    presentCond.notify_all();
 
     if (res == Result::SUCCESS) {
+        computeFramesCounter.increment();
         return res;
     }
 
     if (res == Result::TIMEOUT ||
         res == Result::SKIP) {
-        JST_WARN("[SCHEDULER] Graph underrun. Skipping frame.");
-        return Result::SUCCESS;
+        skippedFramesCounter.increment();
+        return Result::SKIP;
     }
 
-    JST_FATAL("SCHEDULER] Fatal error code: {}", static_cast<uint8_t>(res));
+    JST_ERROR("[SCHEDULER] Step failed with error code: {}", static_cast<uint8_t>(res));
+    return res;
+}
+
+Result Scheduler::rebindTransfers(const void* previous, void* current) {
+    std::unique_lock<std::mutex> lock(sharedMutex);
+
+    for (const auto& graph : graphs) {
+        JST_CHECK(graph->rebindTransfers(previous, current));
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::computeFrame() {
+    Result res = Result::SUCCESS;
+    {
+        std::unique_lock<std::mutex> lock(sharedMutex);
+        computeCond.wait(lock, [&] { return !presentSync; });
+        computeSync = true;
+
+        const auto start = Latency::Clock::now();
+
+        // Private copies only live for one frame. Return them to the pool
+        // before the writers run again.
+        for (const auto& cow : copyOnWriteVectors) {
+            cow->reset();
+        }
+
+        if (numaClusters.empty()) {
+            for (U64 i = 0; i < graphs.size() && res == Result::SUCCESS; i++) {
+                // Graphs on other devices run asynchronously. Wait for
+                // the producers of this graph before consuming their outputs.
+                for (const auto& producer : graphDependencies[i]) {
+                    if ((res = producer->synchronize()) != Result::SUCCESS) {
+                        break;
+                    }
+                }
+
+                if (res == Result::SUCCESS) {
+                    res = graphs[i]->compute();
+                }
+            }
+        } else {
+            res = computeNumaClusters();
+        }
+
+        const auto end = Latency::Clock::now();
+        computeTimeGauge.set(std::chrono::duration<F64>(end - start).count());
+
+        if (res == Result::SUCCESS) {
+            // The frame is as old as the oldest sample consumed by a source.
+            // Without a stamping source, the frame starts with the compute.
+            Latency::Timestamp capture = start;
+            for (const auto& [_, state] : validComputeModuleStates) {
+                const auto timestamp = state.module->captureTimestamp();
+                if (timestamp != Latency::Timestamp{} && timestamp < capture) {
+                    capture = timestamp;
+                }
+            }
+
+            computedFrame.capture = capture;
+            computedFrame.computeStart = start;
+            computedFrame.computeEnd = end;
+            computedFrame.sequence += 1;
+            computedSequence.store(computedFrame.sequence, std::memory_order_relaxed);
+        }
+
+        computeSync = false;
+    }
+    presentCond.notify_all();
+
     return res;
 }
 
@@ -259,12 +383,42 @@ Result Scheduler::present() {
         std::unique_lock<std::mutex> lock(sharedMutex);
         presentCond.wait(lock, [&] { return !computeSync; });
 
-        for (const auto& [_, state] : validPresentModuleStates) {
+        const auto start = Latency::Clock::now();
+
+        // Finish the work still in flight before rendering its outputs.
+        for (const auto& graph : graphs) {
+            JST_CHECK(graph->synchronize());
+        }
+
+        for (auto& [_, state] : validPresentModuleStates) {
+            const bool fresh = state.lastSequence != computedFrame.sequence;
+
+            // Aggregate every frame computed since the last present.
+            if (fresh) {
+                JST_CHECK(state.module->finalize());
+            }
+
             JST_CHECK(state.module->present());
+
+            // Only account for the first present of each computed frame.
+            if (fresh) {
+                state.lastSequence = computedFrame.sequence;
+
+                state.latency.record(Latency::Stage::RingBuffer, computedFrame.computeStart - computedFrame.capture);
+                state.latency.record(Latency::Stage::Compute, computedFrame.computeEnd - computedFrame.computeStart);
+                state.latency.record(Latency::Stage::PresentQueue, start - computedFrame.computeEnd);
+                state.latency.record(Latency::Stage::Total, Latency::Clock::now() - computedFrame.capture);
+            }
         }
 
+        if (computedFrame.sequence > 0) {
+            Latency::SetDisplayed(computedFrame.capture);
+        }
+        presentedSequence = computedFrame.sequence;
+
         presentSync = false;
     }
+    presentFramesCounter.increment();
     computeCond.notify_all();
 
     return Result::SUCCESS;
@@ -511,9 +665,18 @@ Result Scheduler::arrangeDependencyOrder() {
 Result Scheduler::checkSequenceValidity() {
     JST_DEBUG("[SCHEDULER] Gathering modules with inplace operations.");
     std::unordered_map<U64, std::vector<std::string>> inplaceVectorsMap;
+    std::unordered_set<U64> aliasedVectors;
     for (const auto& name : executionOrder) {
         auto& state = validComputeModuleStates[name];
 
+        // Views share the memory of their input without writing to it.
+        if (state.module->outputsAliasInputs()) {
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                aliasedVectors.emplace(outputMeta->hash);
+            }
+            continue;
+        }
+
         std::unordered_set<U64> inputs;
         for (const auto& [_, inputMeta] : state.activeInputs) {
             inputs.emplace(inputMeta->hash);
@@ -557,25 +720,99 @@ Result Scheduler::checkSequenceValidity() {
                                           std::back_inserter(inplaceModules));
             if (inplaceModules.size() > 0) {
                 JST_WARN("[SCHEDULER] Vector is being shared by at least two modules after a branch "
-                          "and at least one of them is an in-place module.");
+                          "and at least one of them is an in-place module. The module should publish "
+                          "a copy-on-write output instead.");
                 JST_WARN("    Hash: 0x{:016x} | Pos: {} | Modules: {}", hash,
                                                                         phash - hash,
                                                                         blocks);
-                //return Result::ERROR;
-                // TODO: Implement copy module.
             }
         }
     }
 
+    JST_DEBUG("[SCHEDULER] Marking copy-on-write vectors with branched sources.");
+    std::unordered_map<U64, std::pair<std::string, const Parser::Record*>> owners;
+    for (const auto& name : executionOrder) {
+        for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+            owners[outputMeta->hash] = {name, outputMeta};
+        }
+    }
+
+    for (const auto& cow : copyOnWriteVectors) {
+        cow->release();
+    }
+    copyOnWriteVectors.clear();
+
+    // Outputs without readers are inactive but are still written.
+    for (const auto& name : executionOrder) {
+        for (const auto& [_, outputMeta] : validComputeModuleStates[name].outputMap) {
+            const auto& cow = outputMeta.copyOnWrite;
+            if (!cow) {
+                continue;
+            }
+
+            // Every view of the source is a different locale with the same hash.
+            std::set<std::string> readers;
+            for (const auto& [hashes, blocks] : pMap) {
+                if (hashes.first == cow->source_hash) {
+                    readers.insert(blocks.begin(), blocks.end());
+                }
+            }
+
+            // Only outputs rewritten by a CPU module every frame can be written
+            // in-place. Host memory, views and other clones are copied.
+            bool owned = false;
+            if (owners.contains(cow->source_hash)) {
+                const auto& [ownerName, ownerMeta] = owners.at(cow->source_hash);
+                const auto& owner = validComputeModuleStates[ownerName];
+                owned = owner.device == Device::CPU &&
+                        !owner.module->outputsAliasInputs() &&
+                        !ownerMeta->copyOnWrite;
+            }
+
+            cow->release();
+            cow->shared = readers.size() > 1 || !owned;
+            copyOnWriteVectors.push_back(cow);
+
+            JST_TRACE("[SCHEDULER] Copy-on-write vector from '{}' is {}.", name, (cow->shared) ? "shared" : "private");
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Asserting that in-place modules aren't writing into shared views.");
+    for (const auto& hash : aliasedVectors) {
+        if (!inplaceVectorsMap.contains(hash)) {
+            continue;
+        }
+
+        // Every view of a buffer is a different locale with the same hash.
+        std::set<std::string> readers;
+        for (const auto& [hashes, blocks] : pMap) {
+            if (hashes.first == hash) {
+                readers.insert(blocks.begin(), blocks.end());
+            }
+        }
+
+        if (readers.size() > 1) {
+            JST_WARN("[SCHEDULER] In-place module is writing into a view shared with other modules.");
+            JST_WARN("    Hash: 0x{:016x} | Writers: {} | Readers: {}", hash,
+                                                                       inplaceVectorsMap[hash],
+                                                                       readers);
+        }
+    }
+
     return Result::SUCCESS;
 }
 
 Result Scheduler::createExecutionGraphs() {
     graphs.clear();
 
+    computeBlocksGauge.set(validComputeModuleStates.size());
+    presentBlocksGauge.set(validPresentModuleStates.size());
+
     JST_DEBUG("[SCHEDULER] Instantiating compute graphs and adding wired Vectors.");
+    std::vector<U64> graphClusters;
     for (const auto& [device, blocksNames] : deviceExecutionOrder) {
         auto graph = NewGraph(device);
+        graphClusters.push_back(validComputeModuleStates[blocksNames.front()].clusterId);
 
         for (const auto& blockName : blocksNames) {
             auto& state = validComputeModuleStates[blockName];
@@ -588,12 +825,76 @@ Result Scheduler::createExecutionGraphs() {
                 graph->setWiredOutput(outputMeta->locale.hash());
             }
 
-            graph->setModule(state.module);
+            graph->setModule(state.module, blockName);
         }
 
+        graph->setProfiling(profiling);
         graphs.push_back(std::move(graph));
     }
 
+    JST_DEBUG("[SCHEDULER] Inserting transfers between devices.");
+    graphDependencies.assign(graphs.size(), {});
+
+    std::unordered_map<U64, std::pair<const Parser::Record*, U64>> producers;
+    for (U64 i = 0; i < deviceExecutionOrder.size(); i++) {
+        for (const auto& blockName : deviceExecutionOrder[i].second) {
+            for (const auto& [_, outputMeta] : validComputeModuleStates[blockName].activeOutputs) {
+                producers[outputMeta->locale.hash()] = {outputMeta, i};
+            }
+        }
+    }
+
+    for (U64 i = 0; i < deviceExecutionOrder.size(); i++) {
+        for (const auto& blockName : deviceExecutionOrder[i].second) {
+            for (const auto& [_, inputMeta] : validComputeModuleStates[blockName].activeInputs) {
+                if (!producers.contains(inputMeta->locale.hash())) {
+                    continue;
+                }
+
+                const auto& [outputMeta, producerIndex] = producers.at(inputMeta->locale.hash());
+                if (outputMeta->device == inputMeta->device) {
+                    continue;
+                }
+
+                const auto& producer = graphs[producerIndex];
+                const auto& consumer = graphs[i];
+
+                auto& dependencies = graphDependencies[i];
+                if (std::ranges::find(dependencies, producer) == dependencies.end()) {
+                    dependencies.push_back(producer);
+                }
+
+                // Staged clones hold a private copy. The graph running on
+                // the accelerator copies it from or to the host.
+                if (!inputMeta->staged) {
+                    continue;
+                }
+
+                const auto& owner = (outputMeta->device == Device::CPU) ? consumer : producer;
+
+                JST_DEBUG("[SCHEDULER] Transferring '{}' from {} to {} ({} bytes).", inputMeta->locale,
+                                                                                   outputMeta->device,
+                                                                                   inputMeta->device,
+                                                                                   inputMeta->sizeBytes);
+
+                // Copy-on-write outputs move between their source and a
+                // private copy. Transfers need a fixed host pointer.
+                void* source = outputMeta->data;
+                if (outputMeta->copyOnWrite) {
+                    JST_CHECK(outputMeta->copyOnWrite->pin());
+                    source = outputMeta->copyOnWrite->copy;
+                }
+
+                JST_CHECK(owner->addTransfer({
+                    .device = outputMeta->device,
+                    .source = source,
+                    .target = inputMeta->data,
+                    .sizeBytes = inputMeta->sizeBytes,
+                }));
+            }
+        }
+    }
+
     JST_DEBUG("[SCHEDULER] Creating dependency list between graphs.");
     std::shared_ptr<Graph> previousGraph;
     for (auto& currentGraph : graphs) {
@@ -613,9 +914,216 @@ Result Scheduler::createExecutionGraphs() {
         }
     }
 
+    JST_CHECK(placeGatheredInputs());
+    JST_CHECK(placeNumaClusters(graphClusters));
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::placeGatheredInputs() {
+    JST_DEBUG("[SCHEDULER] Placing producer outputs inside gathered outputs.");
+
+    std::unordered_map<U64, std::string> producers;
+    for (const auto& name : executionOrder) {
+        for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+            producers[outputMeta->locale.hash()] = name;
+        }
+    }
+
+    // Copy-on-write clones borrow the memory of their source.
+    std::unordered_set<U64> borrowed;
+    for (const auto& cow : copyOnWriteVectors) {
+        borrowed.insert(cow->source_hash);
+    }
+
+    // Every reader of a placed buffer follows it. Readers on other devices
+    // hold their own copy and would be left behind.
+    const auto cpuOnly = [&](const U64& hash) {
+        for (const auto& [_, state] : validComputeModuleStates) {
+            for (const auto& [_, inputMeta] : state.activeInputs) {
+                if (inputMeta->hash == hash && inputMeta->device != Device::CPU) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    // In-place producers write into the buffer of their own producer.
+    const auto inPlace = [&](const ComputeModuleState& state, const U64& hash) {
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            if (inputMeta->hash == hash) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Outer modules go first. Their output is final when the inner ones place into it.
+    std::unordered_set<U64> placed;
+    for (const auto& name : std::views::reverse(executionOrder)) {
+        auto& state = validComputeModuleStates[name];
+
+        if (state.device != Device::CPU) {
+            continue;
+        }
+
+        std::unordered_set<U64> locales;
+        std::unordered_set<std::string> candidates;
+        for (const auto& [inputName, inputMeta] : state.activeInputs) {
+            const auto& locale = inputMeta->locale.hash();
+
+            if (!producers.contains(locale) || placed.contains(locale) || locales.contains(locale)) {
+                continue;
+            }
+
+            const auto& producer = validComputeModuleStates[producers.at(locale)];
+            if (producer.device != Device::CPU ||
+                producer.module->outputsAliasInputs() ||
+                inPlace(producer, inputMeta->hash)) {
+                continue;
+            }
+
+            if (!inputMeta->contiguous ||
+                inputMeta->copyOnWrite ||
+                borrowed.contains(inputMeta->hash) ||
+                !cpuOnly(inputMeta->hash)) {
+                continue;
+            }
+
+            locales.insert(locale);
+            candidates.insert(inputName);
+        }
+
+        if (candidates.empty()) {
+            continue;
+        }
+
+        std::unordered_map<std::string, void*> addresses;
+        JST_CHECK(state.module->placeInputs(candidates, addresses));
+
+        // Keep the records pointing at the memory in use.
+        for (const auto& [inputName, address] : addresses) {
+            const auto locale = state.activeInputs.at(inputName)->locale.hash();
+            placed.insert(locale);
+
+            for (auto& [_, other] : computeModuleStates) {
+                for (auto& [_, meta] : other.outputMap) {
+                    if (meta.locale.hash() == locale) {
+                        meta.data = address;
+                    }
+                }
+                for (auto& [_, meta] : other.inputMap) {
+                    if (meta.locale.hash() == locale) {
+                        meta.data = address;
+                    }
+                }
+            }
+
+            JST_DEBUG("[SCHEDULER] Input '{}' of '{}' is placed inside its output.", inputName, name);
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::placeNumaClusters(const std::vector<U64>& graphClusters) {
+    numaClusters.clear();
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    const U64 nodes = Backend::CPU::GetNumaNodeCount();
+    if (nodes <= 1) {
+        return Result::SUCCESS;
+    }
+
+    // Clusters running on other devices are synchronized by the compute
+    // thread. Keep the sequential execution for mixed pipelines.
+    std::map<U64, NumaCluster> clusters;
+    for (U64 i = 0; i < graphs.size(); i++) {
+        if (graphs[i]->device() != Device::CPU) {
+            return Result::SUCCESS;
+        }
+        clusters[graphClusters[i]].graphs.push_back(graphs[i]);
+    }
+
+    if (clusters.size() <= 1) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[SCHEDULER] Placing {} independent clusters across {} NUMA nodes.", clusters.size(), nodes);
+
+    numaBackend = Backend::State<Device::CPU>().get();
+
+    U64 index = 0;
+    for (auto& [clusterId, cluster] : clusters) {
+        cluster.node = index++ % nodes;
+
+        // Migrate the buffers written by the cluster to its node.
+        for (const auto& [name, state] : validComputeModuleStates) {
+            // Views live in the memory of the module that produced their input.
+            if (state.clusterId != clusterId || state.module->outputsAliasInputs()) {
+                continue;
+            }
+
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                // Strided outputs may overlap and don't span their size in bytes.
+                if (!outputMeta->contiguous) {
+                    continue;
+                }
+                Backend::CPU::BindMemory(outputMeta->data, outputMeta->sizeBytes, cluster.node);
+            }
+        }
+
+        numaClusters.push_back(std::move(cluster));
+    }
+#else
+    (void)graphClusters;
+#endif
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::computeNumaClusters() {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    auto* cpu = numaBackend;
+
+    std::vector<Result> results(numaClusters.size(), Result::SUCCESS);
+    std::vector<std::future<void>> futures;
+
+    for (U64 i = 0; i < numaClusters.size(); i++) {
+        futures.push_back(cpu->submit([&, i]{
+            for (const auto& graph : numaClusters[i].graphs) {
+                if ((results[i] = graph->compute()) != Result::SUCCESS) {
+                    break;
+                }
+            }
+        }, numaClusters[i].node));
+    }
+
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    for (const auto& result : results) {
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+    }
+#endif
+
     return Result::SUCCESS;
 }
 
+void Scheduler::setProfiling(const bool& enabled) {
+    JST_DEBUG("[SCHEDULER] {} per-module profiler.", (enabled) ? "Enabling" : "Disabling");
+
+    profiling = enabled;
+
+    for (const auto& graph : graphs) {
+        graph->setProfiling(enabled);
+    }
+}
+
 void Scheduler::drawDebugMessage() const {
     ImGui::TableNextRow();
     ImGui::TableSetColumnIndex(0);
@@ -656,6 +1164,50 @@ void Scheduler::drawDebugMessage() const {
         ImGui::TableSetColumnIndex(1);
         ImGui::TextFormatted("[{}] {}: {} blocks", count, GetDevicePrettyName(device), blocks.size());
     }
+
+    if (!validPresentModuleStates.empty()) {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextFormatted("Latency:");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextUnformatted("p50 | p99 (ms)");
+
+        for (const auto& [name, state] : validPresentModuleStates) {
+            const auto* histogram = state.latency.histogram(Latency::Stage::Total);
+            if (!histogram) {
+                continue;
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("  {}", name);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{:.2f} | {:.2f}", histogram->quantile(0.50) * 1e3,
+                                                    histogram->quantile(0.99) * 1e3);
+        }
+    }
+
+    if (!profiling) {
+        return;
+    }
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextFormatted("Profile:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextUnformatted("ms | IPC | LLC MPKI");
+
+    for (const auto& graph : graphs) {
+        for (const auto& entry : graph->getProfile()) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextFormatted("  {}", entry->name);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::TextFormatted("{:.3f} | {:.2f} | {:.2f}", entry->msPerCompute.load(std::memory_order_relaxed),
+                                                             entry->ipc.load(std::memory_order_relaxed),
+                                                             entry->cacheMissesPerKiloInstruction.load(std::memory_order_relaxed));
+        }
+    }
 }
 
 }  // namespace Jetstream
@@ -97,6 +97,7 @@ Result Flowgraph::destroy() {
     _author.clear();
     _license.clear();
     _description.clear();
+    _cpuSettings.clear();
     _yaml.clear();
 
     _filename.clear();
@@ -174,6 +175,17 @@ Result Flowgraph::exportToBlob() {
         }
     }
 
+    if (!_cpuSettings.empty()) {
+        ryml::NodeRef cpu = root["cpu"];
+        cpu |= ryml::MAP;
+
+        for (const auto& [key, value] : _cpuSettings) {
+            const auto& k = ryml::to_csubstr(key);
+            cpu[k] << value;
+            cpu[k] |= ryml::_WIP_VAL_PLAIN;
+        }
+    }
+
     ryml::NodeRef graph;
     if (!_nodesOrder.empty()) {
         graph = root["graph"];
@@ -341,6 +353,20 @@ Result Flowgraph::importFromBlob() {
         _description = ResolveReadable(optConfigValues["description"]);
     }
 
+    if (HasNode(root, root, "cpu")) {
+        const auto cpuValues = GatherNodes(root, GetNode(root, root, "cpu"), {"workers",
+                                                                            "computeCore",
+                                                                            "renderCore",
+                                                                            "sourceCore",
+                                                                            "realtimePriority",
+                                                                            "lockMemory"}, true);
+        for (const auto& [key, value] : cpuValues) {
+            _cpuSettings[key] = ResolveReadable(value);
+        }
+
+        JST_CHECK(applyCpuSettings());
+    }
+
     if (!HasNode(root, root, "graph")) {
         return Result::SUCCESS;
     }
@@ -537,6 +563,58 @@ Result Flowgraph::setDescription(const std::string& description) {
     return Result::SUCCESS;
 }
 
+Result Flowgraph::setCpuSettings(const std::map<std::string, std::string>& settings) {
+    if (!_imported) {
+        JST_ERROR("[FLOWGRAPH] Flowgraph is not imported.");
+        return Result::ERROR;
+    }
+
+    _cpuSettings = settings;
+
+    return applyCpuSettings();
+}
+
+Result Flowgraph::applyCpuSettings() {
+    if (_cpuSettings.empty()) {
+        return Result::SUCCESS;
+    }
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    auto& cpu = Backend::State<Device::CPU>();
+    auto config = cpu->getConfig();
+
+    try {
+        for (const auto& [key, value] : _cpuSettings) {
+            if (key == "workers") {
+                config.workerThreads = std::stoull(value);
+            } else if (key == "computeCore") {
+                config.computeCore = std::stoll(value);
+            } else if (key == "renderCore") {
+                config.renderCore = std::stoll(value);
+            } else if (key == "sourceCore") {
+                config.sourceCore = std::stoll(value);
+            } else if (key == "realtimePriority") {
+                config.realtimePriority = std::stoull(value);
+            } else if (key == "lockMemory") {
+                config.lockMemory = (value == "true");
+            } else {
+                JST_WARN("[FLOWGRAPH] Unknown CPU setting '{}'.", key);
+            }
+        }
+    } catch (...) {
+        JST_ERROR("[FLOWGRAPH] Invalid CPU settings.");
+        return Result::ERROR;
+    }
+
+    JST_DEBUG("[FLOWGRAPH] Applying CPU settings from flowgraph.");
+    JST_CHECK(cpu->reconfigure(config));
+#else
+    JST_WARN("[FLOWGRAPH] CPU backend is not available. Ignoring CPU settings.");
+#endif
+
+    return Result::SUCCESS;
+}
+
 Result Flowgraph::print() const {
     if (!_imported) {
         JST_ERROR("[FLOWGRAPH] Flowgraph is not imported.");
@@ -14,6 +14,10 @@ Result Instance::buildDefaultInterface(const Device& preferredDevice,
         return Result::ERROR;
     }
 
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    JST_CHECK(Backend::Initialize<Device::CPU>(backendConfig));
+#endif
+
     std::vector<Device> devicePriority = {
         preferredDevice,
         Device::Metal,
@@ -507,7 +511,67 @@ Result Instance::compute() {
     return Result::SUCCESS;
 }
 
+Result Instance::step() {
+    return _scheduler.step();
+}
+
+Result Instance::findInputRecord(const Locale& locale, Parser::Record*& record) {
+    for (auto& [_, node] : _flowgraph.nodes()) {
+        for (auto& [_, meta] : node->inputMap) {
+            if (meta.locale == locale) {
+                record = &meta;
+                return Result::SUCCESS;
+            }
+        }
+    }
+
+    JST_ERROR("[INSTANCE] Graph input '{}' is not connected to any module.", locale);
+    return Result::ERROR;
+}
+
+Result Instance::findOutputRecord(const Locale& locale, Parser::Record*& record) {
+    const auto& it = _flowgraph.nodes().find(locale.module());
+    if (it != _flowgraph.nodes().end()) {
+        auto& outputMap = it->second->outputMap;
+        const auto& meta = outputMap.find(locale.pinId);
+        if (meta != outputMap.end()) {
+            record = &meta->second;
+            return Result::SUCCESS;
+        }
+    }
+
+    JST_ERROR("[INSTANCE] Output '{}' doesn't exist.", locale);
+    return Result::ERROR;
+}
+
+Result Instance::updateRebound(const void* previous, void* current) {
+    // Records and staged transfers keep the address seen when the graph
+    // was built. Point them at the rebound memory.
+    for (auto& [_, node] : _flowgraph.nodes()) {
+        for (auto& [_, meta] : node->inputMap) {
+            if (meta.data == previous) {
+                meta.data = current;
+            }
+        }
+        for (auto& [_, meta] : node->outputMap) {
+            if (meta.data == previous) {
+                meta.data = current;
+            }
+        }
+    }
+
+    return _scheduler.rebindTransfers(previous, current);
+}
+
 Result Instance::begin() {
+    // Skip the frame if nothing changed (render-on-demand).
+    if (!_window->shouldDraw(_scheduler.presentPending() || _compositor.redrawPending())) {
+#ifndef JST_OS_BROWSER
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+#endif
+        return Result::SKIP;
+    }
+
     // Create new render frame.
     JST_CHECK(_window->begin());
 
@@ -0,0 +1,25 @@
+#include "jetstream/latency.hh"
+
+namespace Jetstream {
+
+static std::atomic<Latency::Clock::rep> displayedTimestamp{0};
+
+Latency::Tracker::Tracker(const std::string& output) {
+    for (U64 i = 0; i < StageCount; i++) {
+        const auto stage = static_cast<Stage>(i);
+        const auto labels = fmt::format("output=\"{}\",stage=\"{}\"", output, StageToString(stage));
+        histograms[i] = &Metrics::GetHistogram("jetstream_latency_seconds",
+                                               "End-to-end sample latency per output and stage.",
+                                               labels);
+    }
+}
+
+void Latency::SetDisplayed(const Timestamp& timestamp) {
+    displayedTimestamp.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+Latency::Timestamp Latency::Displayed() {
+    return Timestamp(Clock::duration(displayedTimestamp.load(std::memory_order_relaxed)));
+}
+
+}  // namespace Jetstream
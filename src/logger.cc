@@ -1,6 +1,11 @@
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
 #include <cstdlib>
 #include <string>
+#include <string_view>
 
 #include "jetstream/logger.hh"
 
@@ -33,4 +38,270 @@ int& _JST_LOG_DEBUG_LEVEL() {
                                             std::atoi(getenv("JST_DEBUG")) : \
                                             JST_LOG_DEBUG_DEFAULT_LEVEL);
     return __JST_LOG_DEBUG_LEVEL;
-}
\ No newline at end of file
+}
+
+//
+// Asynchronous Backend
+//
+
+// Bounded multi-producer queue (Vyukov). Slots are claimed by the producers
+// and formatted in-place. The consumer side is serialized by the log mutex.
+
+class _JST_LOG_QUEUE {
+ public:
+    static constexpr uint64_t Size = 1024;
+
+    _JST_LOG_QUEUE() {
+        for (uint64_t i = 0; i < Size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    _JST_LOG_RECORD* acquire(const _JST_LOG_TYPE& type, uint64_t& ticket) {
+        uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+        while (true) {
+            auto& cell = cells[position & (Size - 1)];
+            const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    ticket = position;
+                    return &cell.record;
+                }
+            } else if (difference < 0) {
+                if (type < _JST_LOG_TYPE::Info) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                return nullptr;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void commit(const uint64_t& ticket) {
+        cells[ticket & (Size - 1)].sequence.store(ticket + 1, std::memory_order_release);
+    }
+
+    template<typename Callback>
+    uint64_t drain(const Callback& callback) {
+        uint64_t count = 0;
+
+        while (true) {
+            auto& cell = cells[dequeuePosition & (Size - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+                break;
+            }
+
+            callback(cell.record);
+
+            cell.sequence.store(dequeuePosition + Size, std::memory_order_release);
+            dequeuePosition += 1;
+            count += 1;
+        }
+
+        return count;
+    }
+
+    uint64_t takeDropped() {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+ private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        _JST_LOG_RECORD record;
+    };
+
+    Cell cells[Size];
+    alignas(64) std::atomic<uint64_t> enqueuePosition{0};
+    alignas(64) uint64_t dequeuePosition = 0;
+    std::atomic<uint64_t> dropped{0};
+};
+
+class _JST_LOG_BACKEND {
+ public:
+    _JST_LOG_BACKEND() {
+#ifndef JST_OS_BROWSER
+        worker = std::thread([this]{
+            auto deadline = std::chrono::steady_clock::now();
+
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(wakeMutex);
+                    committed.wait_until(lock, deadline, [&]{
+                        return pending.load(std::memory_order_relaxed);
+                    });
+                }
+                pending.exchange(false, std::memory_order_acquire);
+
+                std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+                flush(false);
+                deadline = nextSummary();
+            }
+        });
+        worker.detach();
+
+        std::atexit(_JST_LOG_FLUSH);
+
+        asynchronous = true;
+#endif
+    }
+
+    _JST_LOG_RECORD* acquire(const _JST_LOG_TYPE& type, uint64_t& ticket) {
+        if (!asynchronous) {
+            return &scratch;
+        }
+        return queue.acquire(type, ticket);
+    }
+
+    void commit(const uint64_t& ticket) {
+        if (!asynchronous) {
+            if (!scratch.spilled) {
+                writeSync(scratch.type, {scratch.text, scratch.size});
+            }
+            return;
+        }
+        queue.commit(ticket);
+
+        // Only the first record after a drain wakes the worker.
+        if (!pending.exchange(true, std::memory_order_acq_rel)) {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+            }
+            committed.notify_one();
+        }
+    }
+
+    void writeSync(const _JST_LOG_TYPE& type, const std::string_view& text) {
+        std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+        flush(false);
+        print(type, text);
+        flush(true);
+    }
+
+    // Must be called with the log mutex held.
+    void flush(const bool& force) {
+        queue.drain([&](const _JST_LOG_RECORD& record) {
+            // Spilled records were already written in full by the caller.
+            if (!record.spilled) {
+                print(record.type, {record.text, record.size});
+            }
+        });
+
+        if (const auto dropped = queue.takeDropped()) {
+            summarize();
+            batch += format(_JST_LOG_TYPE::Warn, fmt::format("Log queue full. Dropped {} trace/debug messages.", dropped));
+        }
+
+        // Long repeated streams get one summary per second.
+        const auto now = std::chrono::steady_clock::now();
+        if (repeats > 0 && (force || (now - lastPrint) >= std::chrono::seconds(1))) {
+            summarize();
+            lastPrint = now;
+        }
+
+        if (!batch.empty()) {
+            _JST_LOG_SINK << batch;
+            _JST_LOG_SINK.flush();
+            batch.clear();
+        }
+    }
+
+ private:
+    _JST_LOG_QUEUE queue;
+    std::thread worker;
+    bool asynchronous = false;
+
+    // The worker sleeps until a record is committed or a summary is due.
+    std::mutex wakeMutex;
+    std::condition_variable committed;
+    alignas(64) std::atomic<bool> pending{false};
+    thread_local static _JST_LOG_RECORD scratch;
+
+    std::string batch;
+    _JST_LOG_TYPE lastType = _JST_LOG_TYPE::Info;
+    std::string lastText;
+    uint64_t repeats = 0;
+    std::chrono::steady_clock::time_point lastPrint;
+
+    static std::string format(const _JST_LOG_TYPE& type, const std::string_view& text) {
+        switch (type) {
+            case _JST_LOG_TYPE::Trace:
+                return _JST_LOG_NAME + _JST_LOG_TRACE + _JST_LOG_SEPR + _JST_LOG_DEFAULT("{}", text) + "\n";
+            case _JST_LOG_TYPE::Debug:
+                return _JST_LOG_NAME + _JST_LOG_DEBUG + _JST_LOG_SEPR + _JST_LOG_ORANGE("{}", text) + "\n";
+            case _JST_LOG_TYPE::Info:
+                return _JST_LOG_NAME + _JST_LOG_INFO + _JST_LOG_SEPR + _JST_LOG_CYAN("{}", text) + "\n";
+            case _JST_LOG_TYPE::Warn:
+                return _JST_LOG_NAME + _JST_LOG_WARN + _JST_LOG_SEPR + _JST_LOG_YELLOW("{}", text) + "\n";
+            case _JST_LOG_TYPE::Error:
+                return _JST_LOG_NAME + _JST_LOG_ERROR + _JST_LOG_SEPR + _JST_LOG_RED("{}", text) + "\n";
+            case _JST_LOG_TYPE::Fatal:
+                return _JST_LOG_NAME + _JST_LOG_FATAL + _JST_LOG_SEPR + _JST_LOG_MAGENTA("{}", text) + "\n";
+        }
+        return "";
+    }
+
+    // Must be called with the log mutex held.
+    std::chrono::steady_clock::time_point nextSummary() const {
+        if (repeats > 0) {
+            return lastPrint + std::chrono::seconds(1);
+        }
+        return std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    }
+
+    void summarize() {
+        if (repeats == 0) {
+            return;
+        }
+        batch += format(lastType, fmt::format("Last message repeated {} times.", repeats));
+        repeats = 0;
+    }
+
+    void print(const _JST_LOG_TYPE& type, const std::string_view& text) {
+        // Collapse identical consecutive messages.
+        if (type == lastType && text == lastText) {
+            repeats += 1;
+            return;
+        }
+
+        summarize();
+
+        batch += format(type, text);
+        lastType = type;
+        lastText = text;
+        lastPrint = std::chrono::steady_clock::now();
+    }
+};
+
+thread_local _JST_LOG_RECORD _JST_LOG_BACKEND::scratch;
+
+static _JST_LOG_BACKEND& _JST_LOG_GET_BACKEND() {
+    // Never destroyed, the logger must outlive every static object.
+    static _JST_LOG_BACKEND* backend = new _JST_LOG_BACKEND();
+    return *backend;
+}
+
+_JST_LOG_RECORD* _JST_LOG_ACQUIRE(const _JST_LOG_TYPE& type, uint64_t& ticket) {
+    return _JST_LOG_GET_BACKEND().acquire(type, ticket);
+}
+
+void _JST_LOG_COMMIT(const uint64_t& ticket) {
+    _JST_LOG_GET_BACKEND().commit(ticket);
+}
+
+void _JST_LOG_WRITE_SYNC(const _JST_LOG_RECORD& record) {
+    _JST_LOG_GET_BACKEND().writeSync(record.type, {record.text, record.size});
+}
+
+void _JST_LOG_WRITE_SYNC(const _JST_LOG_TYPE& type, const std::string_view& text) {
+    _JST_LOG_GET_BACKEND().writeSync(type, text);
+}
+
+void _JST_LOG_FLUSH() {
+    std::lock_guard<std::mutex> lock(_JST_LOG_MUTEX());
+    _JST_LOG_GET_BACKEND().flush(true);
+}
@@ -3,6 +3,7 @@
 #include <compare>
 
 #include "jetstream/memory/buffer.hh"
+#include "jetstream/backend/base.hh"
 
 using namespace std::chrono_literals;
 
@@ -24,7 +25,7 @@ CircularBuffer<T>::CircularBuffer(const U64& capacity)
        capacity(capacity),
        overflows(0) {
     this->reset();
-    this->buffer = std::unique_ptr<T[]>(new T[getCapacity()]);
+    this->allocate();
 }
 
 template<class T>
@@ -34,12 +35,30 @@ CircularBuffer<T>::~CircularBuffer() {
     buffer.reset();
 }
 
+template<class T>
+void CircularBuffer<T>::publishMetrics(const std::string& name) {
+    const auto labels = fmt::format("buffer=\"{}\"", name);
+
+    overflowsCounter = &Metrics::GetCounter("jetstream_buffer_overflows_total",
+                                            "Number of writes that overflowed the circular buffer.", labels);
+    underrunsCounter = &Metrics::GetCounter("jetstream_buffer_underruns_total",
+                                            "Number of reads that timed out waiting for data.", labels);
+    throughputGauge = &Metrics::GetGauge("jetstream_buffer_throughput_samples_per_second",
+                                         "Circular buffer read throughput.", labels);
+    occupancyGauge = &Metrics::GetGauge("jetstream_buffer_occupancy_ratio",
+                                        "Circular buffer occupancy relative to its capacity.", labels);
+}
+
 template<class T>
 Result CircularBuffer<T>::waitBufferOccupancy(const U64& size) {
     std::unique_lock<std::mutex> sync(sync_mtx);
     while (getOccupancy() < size) {
-        if (semaphore.wait_for(sync, 5s) == std::cv_status::timeout)
+        if (semaphore.wait_for(sync, 5s) == std::cv_status::timeout) {
+            if (underrunsCounter) {
+                underrunsCounter->increment();
+            }
             return Result::TIMEOUT;
+        }
     }
     return Result::SUCCESS;
 }
@@ -68,6 +87,15 @@ Result CircularBuffer<T>::get(T* buf, const U64& size) {
         head = (head + size) % getCapacity();
         occupancy -= size;
 
+        // Capture time of the oldest sample read.
+        while (captures.size() > 1 && captures[1].first <= totalRead) {
+            captures.pop_front();
+        }
+        if (!captures.empty()) {
+            captureTime = captures.front().second;
+        }
+        totalRead += size;
+
         // Throughput Calculator
         auto now = std::chrono::system_clock::now();
         std::chrono::duration<double> elapsed = now - lastGet;
@@ -76,6 +104,14 @@ Result CircularBuffer<T>::get(T* buf, const U64& size) {
             throughput = static_cast<F32>(transfers) / elapsed.count();
             transfers = 0.0;
             lastGet = std::chrono::system_clock::now();
+
+            if (throughputGauge) {
+                throughputGauge->set(throughput);
+            }
+        }
+
+        if (occupancyGauge) {
+            occupancyGauge->set(static_cast<F64>(occupancy) / getCapacity());
         }
 
         transfers += size;
@@ -96,10 +132,18 @@ Result CircularBuffer<T>::put(const T* buf, const U64& size) {
 
         if (getCapacity() < (getOccupancy() + size)) {
             overflows += 1;
+            if (overflowsCounter) {
+                overflowsCounter->increment();
+            }
             occupancy = 0;
             head = tail;
+            totalRead = totalWritten;
+            captures.clear();
         }
 
+        captures.emplace_back(totalWritten, std::chrono::steady_clock::now());
+        totalWritten += size;
+
         U64 stage_a = JST_MIN(size, getCapacity() - tail);
         std::copy_n(buf, stage_a, buffer.get() + tail);
 
@@ -125,6 +169,9 @@ Result CircularBuffer<T>::reset() {
         this->transfers = 0;
         this->throughput = 0;
         this->overflows = 0;
+        this->totalWritten = 0;
+        this->totalRead = 0;
+        this->captures.clear();
     }
 
     semaphore.notify_all();
@@ -135,10 +182,24 @@ template<class T>
 Result CircularBuffer<T>::resize(const U64& capacity) {
     this->reset();
     this->capacity = capacity;
-    this->buffer = std::unique_ptr<T[]>(new T[getCapacity()]);
+    this->allocate();
     return Result::SUCCESS;
 }
 
+template<class T>
+void CircularBuffer<T>::allocate() {
+    const U64 sizeBytes = JST_PAGE_ALIGNED_SIZE(getCapacity() * sizeof(T));
+    T* memory = static_cast<T*>(::operator new[](sizeBytes, std::align_val_t(JST_PAGESIZE())));
+
+    // Bind before the constructors first touch the pages.
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    Backend::CPU::BindMemory(memory, sizeBytes, Backend::CPU::GetAllocationNode());
+#endif
+
+    std::uninitialized_value_construct_n(memory, getCapacity());
+    this->buffer = std::unique_ptr<T[], AlignedDeleter>(memory);
+}
+
 template<class T>
 bool CircularBuffer<T>::isEmpty() const {
     return getOccupancy() == 0;
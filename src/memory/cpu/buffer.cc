@@ -43,6 +43,11 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     }
 #endif
 
+    // Vulkan clones are staged through a private device buffer.
+#ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
+    storage->compatible_devices.insert(Device::Vulkan);
+#endif
+
     // Check size.
 
     if (prototype.size_bytes == 0) {
@@ -51,26 +56,7 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
 
     // Allocate memory.
 
-    void* memoryAddr = nullptr;
-    const auto pageSize = JST_PAGESIZE();
-    const auto alignedSizeBytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
-#ifdef JST_OS_WINDOWS
-    buffer = VirtualAlloc(nullptr, alignedSizeBytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-    if (buffer == nullptr) {
-        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
-        JST_CHECK_THROW(Result::ERROR);
-    }
-#else
-    const auto result = posix_memalign(&memoryAddr, pageSize, alignedSizeBytes);
-    if (result < 0 || (buffer = static_cast<void*>(memoryAddr)) == nullptr) {
-        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
-        JST_CHECK_THROW(Result::ERROR);
-    }
-#endif
-    owns_data = true;
-
-    // Null out array.
-    memset(buffer, 0, prototype.size_bytes);
+    allocate(prototype);
 }
 
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
@@ -94,12 +80,41 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     }
 #endif
 
+#ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
+    storage->compatible_devices.insert(Device::Vulkan);
+#endif
+
     // Initialize buffer.
 
     owns_data = false;
     buffer = ptr;
 }
 
+Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
+                             const TensorPrototypeMetadata& prototype,
+                             const std::shared_ptr<TensorBuffer<Device::CPU>>& source_buffer,
+                             const U64& source_offset_bytes,
+                             const U64& source_hash) : source_buffer(source_buffer),
+                                                       source_offset_bytes(source_offset_bytes) {
+    JST_TRACE("[CPU:BUFFER] New copy-on-write buffer.");
+
+    // Initialize storage.
+
+    storage->root_device = Device::CPU;
+    storage->compatible_devices = {
+        Device::CPU,
+    };
+
+    // Borrow the source memory. Private copies come from the pool.
+
+    copy_on_write = std::make_shared<TensorStorageMetadata::CopyOnWrite>();
+    copy_on_write->source_hash = source_hash;
+    copy_on_write->size_bytes = prototype.size_bytes;
+    storage->copy_on_write = copy_on_write;
+
+    owns_data = false;
+}
+
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                              const TensorPrototypeMetadata& prototype,
@@ -128,21 +143,23 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
 #endif
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
-Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
+Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                              const TensorPrototypeMetadata& prototype,
                              const std::shared_ptr<TensorBuffer<Device::Vulkan>>& root_buffer) {
     JST_TRACE("[CPU:BUFFER] Cloning from Vulkan buffer.");
 
-    // Check platform.
+    // Check size.
 
-    if (!root_buffer->host_accessible()) {
-        JST_ERROR("[CPU:BUFFER] Vulkan buffer is not host accessible. Cannot share data with CPU.");
-        JST_CHECK_THROW(Result::ERROR);
+    if (prototype.size_bytes == 0) {
+        return;
     }
 
-    // Check size.
+    // Stage device memory through a private host buffer.
 
-    if (prototype.size_bytes == 0) {
+    if (!root_buffer->host_accessible()) {
+        JST_TRACE("[CPU:BUFFER] Vulkan buffer is not host accessible. Staging through host memory.");
+        storage->staged_devices.insert(Device::CPU);
+        allocate(prototype);
         return;
     }
 
@@ -191,6 +208,103 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>&,
 }
 #endif
 
+Result Implementation::rebind(void* ptr) {
+    if (owns_data || copy_on_write || external_memory_device != Device::None) {
+        JST_ERROR("[CPU:BUFFER] Only buffers created from a raw pointer can be rebound.");
+        return Result::ERROR;
+    }
+
+    buffer = ptr;
+
+    return Result::SUCCESS;
+}
+
+Result Implementation::place(const std::shared_ptr<TensorBuffer<Device::CPU>>& target,
+                             const U64& offset_bytes,
+                             const U64& size_bytes) {
+    auto* placed = static_cast<U8*>(target->data()) + offset_bytes;
+
+    if (source_buffer == target && buffer == placed) {
+        return Result::SUCCESS;
+    }
+
+    if (copy_on_write || external_memory_device != Device::None) {
+        JST_ERROR("[CPU:BUFFER] Copy-on-write and external buffers can't be placed.");
+        return Result::ERROR;
+    }
+
+    // The consumer hosting a placed buffer stops copying it. Moving it again
+    // would leave that consumer reading a slot nobody writes.
+
+    if (source_buffer) {
+        JST_ERROR("[CPU:BUFFER] Buffers already placed can't move to another slot.");
+        return Result::ERROR;
+    }
+
+    // Raw pointers belong to the caller.
+
+    if (!owns_data) {
+        JST_ERROR("[CPU:BUFFER] Only buffers allocated by the tensor can be placed.");
+        return Result::ERROR;
+    }
+
+    // Tensors placed inside this buffer would be left with freed memory.
+
+    if (hosts_placed) {
+        JST_ERROR("[CPU:BUFFER] Buffers holding placed tensors can't be placed.");
+        return Result::ERROR;
+    }
+
+    if (size_bytes != allocated_bytes) {
+        JST_ERROR("[CPU:BUFFER] Placed size ({} bytes) doesn't cover the buffer ({} bytes).", size_bytes,
+                                                                                           allocated_bytes);
+        return Result::ERROR;
+    }
+
+    JST_TRACE("[CPU:BUFFER] Releasing buffer at {} before placing it.", fmt::ptr(buffer));
+#ifdef JST_OS_WINDOWS
+    VirtualFree(buffer, 0, MEM_RELEASE);
+#else
+    free(buffer);
+#endif
+    owns_data = false;
+
+    source_buffer = target;
+    buffer = placed;
+    target->hosts_placed = true;
+
+    return Result::SUCCESS;
+}
+
+void Implementation::allocate(const TensorPrototypeMetadata& prototype) {
+    void* memoryAddr = nullptr;
+    const auto pageSize = JST_PAGESIZE();
+    const auto alignedSizeBytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
+#ifdef JST_OS_WINDOWS
+    buffer = VirtualAlloc(nullptr, alignedSizeBytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (buffer == nullptr) {
+        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+#else
+    const auto result = posix_memalign(&memoryAddr, pageSize, alignedSizeBytes);
+    if (result < 0 || (buffer = static_cast<void*>(memoryAddr)) == nullptr) {
+        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+#endif
+    owns_data = true;
+    allocated_bytes = prototype.size_bytes;
+
+    // Bind pages to the consumer node before they are first touched.
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    Backend::CPU::BindMemory(buffer, alignedSizeBytes, Backend::CPU::GetAllocationNode());
+#endif
+
+    // Null out array.
+    memset(buffer, 0, prototype.size_bytes);
+}
+
 Implementation::~TensorBuffer() {
     JST_TRACE("[CPU:BUFFER] Trying to free buffer at {}.", fmt::ptr(buffer));
 
@@ -0,0 +1,159 @@
+#include <mutex>
+#include <vector>
+#include <cstring>
+#include <unordered_map>
+
+#include "jetstream/memory/macros.hh"
+#include "jetstream/memory/metadata.hh"
+#include "jetstream/memory/devices/cpu/pool.hh"
+#include "jetstream/logger.hh"
+
+#ifdef JST_OS_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef ERROR
+#undef FATAL
+#endif
+
+namespace Jetstream {
+
+struct PoolState {
+    std::mutex mutex;
+    std::unordered_map<U64, std::vector<void*>> blocks;
+};
+
+static PoolState& GetPoolState() {
+    static PoolState state;
+    return state;
+}
+
+void* TensorPool::Acquire(const U64& sizeBytes) {
+    const U64 alignedSizeBytes = JST_PAGE_ALIGNED_SIZE(sizeBytes);
+    auto& state = GetPoolState();
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto& blocks = state.blocks[alignedSizeBytes];
+        if (!blocks.empty()) {
+            void* ptr = blocks.back();
+            blocks.pop_back();
+            return ptr;
+        }
+    }
+
+    JST_TRACE("[CPU:POOL] Allocating new block of {} bytes.", alignedSizeBytes);
+
+    void* ptr = nullptr;
+#ifdef JST_OS_WINDOWS
+    ptr = VirtualAlloc(nullptr, alignedSizeBytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+    if (posix_memalign(&ptr, JST_PAGESIZE(), alignedSizeBytes) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    if (ptr == nullptr) {
+        JST_ERROR("[CPU:POOL] Failed to allocate block of {} bytes.", alignedSizeBytes);
+    }
+    return ptr;
+}
+
+void TensorPool::Release(void* ptr, const U64& sizeBytes) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto& state = GetPoolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.blocks[JST_PAGE_ALIGNED_SIZE(sizeBytes)].push_back(ptr);
+}
+
+U64 TensorPool::Cached() {
+    auto& state = GetPoolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    U64 count = 0;
+    for (const auto& [_, blocks] : state.blocks) {
+        count += blocks.size();
+    }
+    return count;
+}
+
+void TensorPool::Trim() {
+    auto& state = GetPoolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (auto& [_, blocks] : state.blocks) {
+        for (void* ptr : blocks) {
+#ifdef JST_OS_WINDOWS
+            VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+            free(ptr);
+#endif
+        }
+    }
+    state.blocks.clear();
+}
+
+//
+// Copy-on-write
+//
+
+TensorStorageMetadata::CopyOnWrite::~CopyOnWrite() {
+    release();
+}
+
+Result TensorStorageMetadata::CopyOnWrite::write(const void* source) {
+    // Nobody else reads the source. Write in-place.
+    if ((!shared && !pinned) || written) {
+        return Result::SUCCESS;
+    }
+
+    if (copy == nullptr) {
+        copy = TensorPool::Acquire(size_bytes);
+        if (copy == nullptr) {
+            return Result::ERROR;
+        }
+    }
+
+    std::memcpy(copy, source, size_bytes);
+    written = true;
+
+    return Result::SUCCESS;
+}
+
+Result TensorStorageMetadata::CopyOnWrite::pin() {
+    pinned = true;
+
+    if (copy == nullptr) {
+        copy = TensorPool::Acquire(size_bytes);
+        if (copy == nullptr) {
+            return Result::ERROR;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+void TensorStorageMetadata::CopyOnWrite::reset() {
+    written = false;
+
+    if (pinned) {
+        return;
+    }
+
+    release();
+}
+
+void TensorStorageMetadata::CopyOnWrite::release() {
+    pinned = false;
+    written = false;
+
+    if (copy == nullptr) {
+        return;
+    }
+
+    TensorPool::Release(copy, size_bytes);
+    copy = nullptr;
+}
+
+}  // namespace Jetstream
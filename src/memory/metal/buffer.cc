@@ -67,6 +67,14 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
         return;
     }
 
+    // Kernels bind the buffer without an offset. Views would be read from
+    // the start of the allocation.
+
+    if (prototype.offset != 0 || !prototype.contiguous) {
+        JST_ERROR("[METAL:BUFFER] Can't clone a view of a CPU buffer.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+
     // Check alignment.
 
     if (!JST_IS_ALIGNED(root_buffer->data()) && root_buffer->data() != nullptr) {
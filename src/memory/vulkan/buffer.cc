@@ -18,21 +18,13 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
         Device::Vulkan
     };
 
-    // Get device types.
+    // CPU is always compatible. Without unified memory the clone gets a
+    // private host copy that the scheduler keeps in sync.
 
-    auto& device = Backend::State<Device::Vulkan>()->getDevice();
-    auto& physicalDevice = Backend::State<Device::Vulkan>()->getPhysicalDevice();
-    const auto& unified = Backend::State<Device::Vulkan>()->hasUnifiedMemory();
-    const auto& canExport = Backend::State<Device::Vulkan>()->canExportMemory();
-
-    // Add CPU and CUDA support if unified memory is enabled.
-
-    if (host_accessible || unified) {
-        storage->compatible_devices.insert(Device::CPU);
-    }
+    storage->compatible_devices.insert(Device::CPU);
 
 #ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
-    if (canExport) {
+    if (Backend::State<Device::Vulkan>()->canExportMemory()) {
         storage->compatible_devices.insert(Device::CUDA);
     }
 #endif
@@ -43,6 +35,64 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
         return;
     }
 
+    // Allocate memory.
+
+    allocate(prototype, host_accessible, usage);
+}
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
+                             const TensorPrototypeMetadata& prototype,
+                             const std::shared_ptr<TensorBuffer<Device::CPU>>&) {
+    JST_TRACE("[VULKAN:BUFFER] Cloning from CPU buffer.");
+
+    // Check size.
+
+    if (prototype.size_bytes == 0) {
+        return;
+    }
+
+    // Staged copies are dense. Views would be read past their offset.
+
+    if (prototype.offset != 0 || !prototype.contiguous) {
+        JST_ERROR("[VULKAN:BUFFER] Can't stage a view of a CPU buffer.");
+        JST_CHECK_THROW(Result::ERROR);
+    }
+
+    // Host memory can't be imported. Stage it through a private device buffer.
+
+    storage->staged_devices.insert(Device::Vulkan);
+    allocate(prototype, false, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                               VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                               VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+}
+#endif
+
+#ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
+Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
+                             const TensorPrototypeMetadata& prototype,
+                             const std::shared_ptr<TensorBuffer<Device::Metal>>& root_buffer) {
+    throw std::runtime_error("Exporting Metal memory to Vulkan not implemented.");
+}
+#endif
+
+#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
+Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
+                             const TensorPrototypeMetadata& prototype,
+                             const std::shared_ptr<TensorBuffer<Device::CUDA>>& root_buffer) {
+    throw std::runtime_error("Exporting CUDA memory to Vulkan not implemented.");
+    // TODO: Add CUDA -> Vulkan.
+}
+#endif
+
+void Implementation::allocate(const TensorPrototypeMetadata& prototype,
+                              const bool& host_accessible,
+                              const VkBufferUsageFlags& usage) {
+    auto& device = Backend::State<Device::Vulkan>()->getDevice();
+    auto& physicalDevice = Backend::State<Device::Vulkan>()->getPhysicalDevice();
+    const auto& unified = Backend::State<Device::Vulkan>()->hasUnifiedMemory();
+    const auto& canExport = Backend::State<Device::Vulkan>()->canExportMemory();
+
     // Create buffer object. 
 
     VkExternalMemoryImageCreateInfo extImageCreateInfo = {};
@@ -110,32 +160,6 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     _host_accessible = host_accessible || unified;
 }
 
-#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
-Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                             const TensorPrototypeMetadata& prototype,
-                             const std::shared_ptr<TensorBuffer<Device::CPU>>& root_buffer) {
-    throw std::runtime_error("Exporting CPU memory to Vulkan not implemented.");
-    // TODO: Add CPU -> Vulkan.
-}
-#endif
-
-#ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
-Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                             const TensorPrototypeMetadata& prototype,
-                             const std::shared_ptr<TensorBuffer<Device::Metal>>& root_buffer) {
-    throw std::runtime_error("Exporting Metal memory to Vulkan not implemented.");
-}
-#endif
-
-#ifdef JETSTREAM_BACKEND_CUDA_AVAILABLE
-Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                             const TensorPrototypeMetadata& prototype,
-                             const std::shared_ptr<TensorBuffer<Device::CUDA>>& root_buffer) {
-    throw std::runtime_error("Exporting CUDA memory to Vulkan not implemented.");
-    // TODO: Add CUDA -> Vulkan.
-}
-#endif
-
 Implementation::~TensorBuffer() {
     JST_TRACE("[VULKAN:BUFFER] Releasing buffer {}.", fmt::ptr(_buffer));
 
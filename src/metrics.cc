@@ -0,0 +1,382 @@
+#include <fstream>
+#include <charconv>
+
+#include "jetstream/metrics.hh"
+
+#if defined(JST_OS_LINUX) || defined(JST_OS_MAC)
+#define JST_METRICS_EXPORTER_AVAILABLE
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+namespace Jetstream {
+
+Metrics& Metrics::getInstance() {
+    static Metrics instance;
+    return instance;
+}
+
+Metrics::~Metrics() {
+    stop();
+}
+
+//
+// Registry
+//
+
+Metrics::Family& Metrics::getFamily(const std::string& name, const std::string& help, const Type& type) {
+    auto& family = families[name];
+
+    if (family.help.empty()) {
+        family.help = help;
+        family.type = type;
+    }
+
+    if (family.type != type) {
+        JST_FATAL("[METRICS] Metric '{}' was registered with a different type.", name);
+        JST_CHECK_THROW(Result::FATAL);
+    }
+
+    return family;
+}
+
+Metrics::Counter& Metrics::getCounter(const std::string& name, const std::string& help, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    auto& counter = getFamily(name, help, Type::Counter).counters[labels];
+    if (!counter) {
+        counter = std::make_unique<Counter>();
+    }
+    return *counter;
+}
+
+Metrics::Gauge& Metrics::getGauge(const std::string& name, const std::string& help, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    auto& gauge = getFamily(name, help, Type::Gauge).gauges[labels];
+    if (!gauge) {
+        gauge = std::make_unique<Gauge>();
+    }
+    return *gauge;
+}
+
+Metrics::Histogram& Metrics::getHistogram(const std::string& name, const std::string& help, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    auto& histogram = getFamily(name, help, Type::Histogram).histograms[labels];
+    if (!histogram) {
+        histogram = std::make_unique<Histogram>();
+    }
+    return *histogram;
+}
+
+//
+// Serialization
+//
+
+std::string Metrics::renderPrometheus() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    std::string out;
+
+    const auto typeName = [](const Type& type) {
+        switch (type) {
+            case Type::Counter:
+                return "counter";
+            case Type::Gauge:
+                return "gauge";
+            case Type::Histogram:
+                return "histogram";
+        }
+        return "untyped";
+    };
+
+    for (const auto& [name, family] : families) {
+        out += fmt::format("# HELP {} {}\n", name, family.help);
+        out += fmt::format("# TYPE {} {}\n", name, typeName(family.type));
+
+        const auto series = [&](const std::string& labels) {
+            return (labels.empty()) ? name : fmt::format("{}{{{}}}", name, labels);
+        };
+
+        for (const auto& [labels, counter] : family.counters) {
+            out += fmt::format("{} {}\n", series(labels), counter->value());
+        }
+
+        for (const auto& [labels, gauge] : family.gauges) {
+            out += fmt::format("{} {}\n", series(labels), gauge->value());
+        }
+
+        for (const auto& [labels, histogram] : family.histograms) {
+            const auto prefix = (labels.empty()) ? "" : labels + ",";
+
+            U64 accumulated = 0;
+            for (U64 i = 0; i < Histogram::BucketCount; i++) {
+                accumulated += histogram->bucket(i);
+                out += fmt::format("{}_bucket{{{}le=\"{}\"}} {}\n", name, prefix, Histogram::Bound(i), accumulated);
+            }
+            out += fmt::format("{}_bucket{{{}le=\"+Inf\"}} {}\n", name, prefix, histogram->count());
+
+            const auto suffix = (labels.empty()) ? "" : fmt::format("{{{}}}", labels);
+            out += fmt::format("{}_sum{} {}\n", name, suffix, histogram->sum());
+            out += fmt::format("{}_count{} {}\n", name, suffix, histogram->count());
+        }
+    }
+
+    return out;
+}
+
+std::string Metrics::renderJson() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    const auto escape = [](const std::string& str) {
+        std::string out;
+        for (const auto& c : str) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out;
+    };
+
+    const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::string out = fmt::format("{{\"timestamp\": {}, \"metrics\": [", timestamp);
+    bool first = true;
+
+    for (const auto& [name, family] : families) {
+        const auto entry = [&](const std::string& labels, const std::string& type, const std::string& value) {
+            out += fmt::format("{}\n  {{\"name\": \"{}\", \"labels\": \"{}\", \"type\": \"{}\", \"value\": {}}}",
+                               (first) ? "" : ",", name, escape(labels), type, value);
+            first = false;
+        };
+
+        for (const auto& [labels, counter] : family.counters) {
+            entry(labels, "counter", fmt::format("{}", counter->value()));
+        }
+
+        for (const auto& [labels, gauge] : family.gauges) {
+            entry(labels, "gauge", fmt::format("{}", gauge->value()));
+        }
+
+        for (const auto& [labels, histogram] : family.histograms) {
+            entry(labels, "histogram", fmt::format("{{\"count\": {}, \"sum\": {}, \"p50\": {}, \"p99\": {}}}",
+                                                   histogram->count(),
+                                                   histogram->sum(),
+                                                   histogram->quantile(0.50),
+                                                   histogram->quantile(0.99)));
+        }
+    }
+
+    out += "\n]}\n";
+
+    return out;
+}
+
+//
+// Exporters
+//
+
+Result Metrics::startDump(const std::string& path, const std::chrono::milliseconds& interval) {
+    if (dumpThread.joinable()) {
+        JST_ERROR("[METRICS] JSON dump is already running.");
+        return Result::ERROR;
+    }
+
+    JST_INFO("[METRICS] Dumping metrics to '{}' every {} ms.", path, interval.count());
+
+    running = true;
+    dumpThread = std::thread([this, path, interval]{
+        auto next = std::chrono::steady_clock::now();
+
+        while (running) {
+            next += interval;
+
+            // Write to a temporary file first so readers never see a partial dump.
+            const std::string tmpPath = path + ".tmp";
+            {
+                std::ofstream file(tmpPath, std::ios::trunc);
+                file << renderJson();
+            }
+            std::rename(tmpPath.c_str(), path.c_str());
+
+            while (running && std::chrono::steady_clock::now() < next) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+#ifdef JST_METRICS_EXPORTER_AVAILABLE
+
+Result Metrics::startExporter(const std::string& endpoint) {
+    if (exporterThread.joinable()) {
+        JST_ERROR("[METRICS] Exporter is already running.");
+        return Result::ERROR;
+    }
+
+    if (endpoint.starts_with("unix:")) {
+        exporterPath = endpoint.substr(5);
+
+        sockaddr_un address{};
+        if (exporterPath.empty() || exporterPath.size() >= sizeof(address.sun_path)) {
+            JST_ERROR("[METRICS] Invalid Unix socket path '{}'.", exporterPath);
+            return Result::ERROR;
+        }
+
+        exporterFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (exporterFd < 0) {
+            JST_ERROR("[METRICS] Failed to open socket.");
+            return Result::ERROR;
+        }
+
+        address.sun_family = AF_UNIX;
+        std::copy(exporterPath.begin(), exporterPath.end(), address.sun_path);
+        unlink(exporterPath.c_str());
+
+        if (bind(exporterFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            JST_ERROR("[METRICS] Failed to bind Unix socket '{}'.", exporterPath);
+            close(exporterFd);
+            exporterFd = -1;
+            return Result::ERROR;
+        }
+    } else {
+        const auto separator = endpoint.rfind(':');
+        if (separator == std::string::npos) {
+            JST_ERROR("[METRICS] Invalid endpoint format. Expected `address:port` or `unix:path`.");
+            return Result::ERROR;
+        }
+
+        const auto port = endpoint.substr(separator + 1);
+        U16 portNumber = 0;
+        const auto [end, error] = std::from_chars(port.data(), port.data() + port.size(), portNumber);
+        if (port.empty() || error != std::errc() || end != port.data() + port.size()) {
+            JST_ERROR("[METRICS] Invalid port '{}'.", port);
+            return Result::ERROR;
+        }
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(portNumber);
+        if (inet_pton(AF_INET, endpoint.substr(0, separator).c_str(), &address.sin_addr) != 1) {
+            JST_ERROR("[METRICS] Invalid address '{}'.", endpoint.substr(0, separator));
+            return Result::ERROR;
+        }
+
+        exporterFd = socket(AF_INET, SOCK_STREAM, 0);
+        if (exporterFd < 0) {
+            JST_ERROR("[METRICS] Failed to open socket.");
+            return Result::ERROR;
+        }
+
+        int reuse = 1;
+        setsockopt(exporterFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        if (bind(exporterFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            JST_ERROR("[METRICS] Failed to bind to '{}'.", endpoint);
+            close(exporterFd);
+            exporterFd = -1;
+            return Result::ERROR;
+        }
+    }
+
+    if (listen(exporterFd, 8) < 0) {
+        JST_ERROR("[METRICS] Failed to listen on '{}'.", endpoint);
+        close(exporterFd);
+        exporterFd = -1;
+        return Result::ERROR;
+    }
+
+    JST_INFO("[METRICS] Serving Prometheus metrics on '{}'.", endpoint);
+
+    running = true;
+    exporterThread = std::thread([this]{
+        while (running) {
+            pollfd pfd = { exporterFd, POLLIN, 0 };
+            if (poll(&pfd, 1, 250) <= 0) {
+                continue;
+            }
+
+            const int client = accept(exporterFd, nullptr, nullptr);
+            if (client < 0) {
+                continue;
+            }
+
+            // The request is not parsed, every path returns the metrics.
+            char request[1024];
+            pollfd cfd = { client, POLLIN, 0 };
+            if (poll(&cfd, 1, 1000) > 0) {
+                (void)!recv(client, request, sizeof(request), 0);
+            }
+
+            const auto body = renderPrometheus();
+            const auto response = fmt::format("HTTP/1.0 200 OK\r\n"
+                                              "Content-Type: text/plain; version=0.0.4\r\n"
+                                              "Content-Length: {}\r\n"
+                                              "Connection: close\r\n"
+                                              "\r\n"
+                                              "{}", body.size(), body);
+
+            U64 sent = 0;
+            while (sent < response.size()) {
+                const auto res = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (res <= 0) {
+                    break;
+                }
+                sent += res;
+            }
+
+            close(client);
+        }
+    });
+
+    return Result::SUCCESS;
+}
+
+#else
+
+Result Metrics::startExporter(const std::string&) {
+    JST_ERROR("[METRICS] Metrics exporter is not supported in this platform.");
+    return Result::ERROR;
+}
+
+#endif
+
+Result Metrics::stop() {
+    running = false;
+
+    if (exporterThread.joinable()) {
+        exporterThread.join();
+    }
+
+    if (dumpThread.joinable()) {
+        dumpThread.join();
+    }
+
+#ifdef JST_METRICS_EXPORTER_AVAILABLE
+    if (exporterFd >= 0) {
+        close(exporterFd);
+        exporterFd = -1;
+    }
+
+    if (!exporterPath.empty()) {
+        unlink(exporterPath.c_str());
+        exporterPath.clear();
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
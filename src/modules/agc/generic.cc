@@ -7,6 +7,13 @@ Result AGC<D, T>::create() {
     JST_DEBUG("Initializing AGC module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
     // Allocate output.
 
     output.buffer = Tensor<D, T>(input.buffer.shape());
@@ -1,19 +1,50 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
-
 namespace Jetstream {
 
 template<Device D, typename IT, typename OT>
 Result Amplitude<D, IT, OT>::createCompute(const RuntimeMetadata&) {
     JST_TRACE("Create Amplitude compute core using CPU backend.");
+
+    JST_CHECK(Backend::StringToMathAccuracy(config.accuracy, cpu.accuracy));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Amplitude compute core using CPU backend.");
     return Result::SUCCESS;
 }
 
+// 20 * log10(|x| / N) is computed as 10 * log10(|x|^2) - 20 * log10(N)
+// to skip the square root.
+
+template<Backend::MathAccuracy A>
+static void ComputeAmplitude(const CF32* input, F32* output, const U64& size, const F32& offset) {
+    for (U64 i = 0; i < size; i++) {
+        const F32 power = input[i].real() * input[i].real() + input[i].imag() * input[i].imag();
+        output[i] = 10.0f * Backend::Log10<A>(power) - offset;
+    }
+}
+
 template<Device D, typename IT, typename OT>
 Result Amplitude<D, IT, OT>::compute(const RuntimeMetadata&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        output.buffer[i] = 20.0f * Backend::ApproxLog10(abs(input.buffer[i]) / scalingSize);
+    const F32 offset = 20.0f * std::log10(static_cast<F32>(scalingSize));
+    const auto* in = input.buffer.data();
+    auto* out = output.buffer.data();
+    const U64 size = input.buffer.size();
+
+    switch (cpu.accuracy) {
+        case Backend::MathAccuracy::Fast:
+            ComputeAmplitude<Backend::MathAccuracy::Fast>(in, out, size, offset);
+            break;
+        case Backend::MathAccuracy::Balanced:
+            ComputeAmplitude<Backend::MathAccuracy::Balanced>(in, out, size, offset);
+            break;
+        case Backend::MathAccuracy::Exact:
+            ComputeAmplitude<Backend::MathAccuracy::Exact>(in, out, size, offset);
+            break;
     }
 
     return Result::SUCCESS;
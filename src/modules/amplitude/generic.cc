@@ -7,6 +7,13 @@ Result Amplitude<D, IT, OT>::create() {
     JST_DEBUG("Initializing Amplitude module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
     // Calculate parameters.
 
     const U64 last_axis = input.buffer.rank() - 1;
@@ -21,7 +28,7 @@ Result Amplitude<D, IT, OT>::create() {
 
 template<Device D, typename IT, typename OT>
 void Amplitude<D, IT, OT>::info() const {
-    JST_INFO("  None");
+    JST_INFO("  Accuracy: {}", config.accuracy);
 }
 
 }  // namespace Jetstream
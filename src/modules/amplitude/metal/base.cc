@@ -56,6 +56,12 @@ Result Amplitude<D, IT, OT>::createCompute(const RuntimeMetadata& meta) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::destroyCompute(const RuntimeMetadata& meta) {
+    JST_TRACE("Destroy Amplitude compute core using Metal backend.");
+    return Result::SUCCESS;
+}
+
 template<Device D, typename IT, typename OT>
 Result Amplitude<D, IT, OT>::compute(const RuntimeMetadata& meta) {
     auto& assets = metal;
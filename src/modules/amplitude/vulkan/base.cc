@@ -0,0 +1,72 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+static const char shadersSrc[] = R"""(
+    #version 450
+
+    layout(local_size_x = 256) in;
+
+    layout(std430, binding = 0) readonly buffer Input { vec2 inputBuffer[]; };
+    layout(std430, binding = 1) writeonly buffer Output { float outputBuffer[]; };
+
+    layout(push_constant) uniform Constants {
+        uint size;
+        uint offset;
+        float scalingSize;
+    } constants;
+
+    void main() {
+        const uint id = gl_GlobalInvocationID.x;
+        if (id >= constants.size) {
+            return;
+        }
+
+        // 20 * log10(x) == (20 / ln(10)) * ln(x)
+        const float magnitude = length(inputBuffer[constants.offset + id]) / constants.scalingSize;
+        outputBuffer[id] = 8.685889638065035 * log(magnitude);
+    }
+)""";
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create Amplitude compute core using Vulkan backend.");
+
+    auto& assets = vulkan;
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("[AMPLITUDE] Vulkan backend requires a contiguous input.");
+        return Result::ERROR;
+    }
+
+    assets.constants.size = output.buffer.size();
+    assets.constants.offset = input.buffer.offset();
+    assets.constants.scalingSize = scalingSize;
+
+    JST_CHECK(Vulkan::CompileKernel(shadersSrc, 2, sizeof(VulkanConstants), assets.kernel));
+    JST_CHECK(Vulkan::BindBuffers(assets.kernel, {input.buffer.data(), output.buffer.data()}));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Amplitude compute core using Vulkan backend.");
+
+    JST_CHECK(Vulkan::DestroyKernel(vulkan.kernel));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::compute(const RuntimeMetadata& meta) {
+    auto& assets = vulkan;
+
+    JST_CHECK(Vulkan::Dispatch(meta, assets.kernel, assets.constants, output.buffer.size()));
+
+    return Result::SUCCESS;
+}
+
+JST_AMPLITUDE_VULKAN(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -55,6 +55,7 @@ Result Audio<D, T>::create() {
     // Initialize circular buffer.
 
     buffer.resize(input.buffer.shape()[1]*20);
+    buffer.publishMetrics(locale().shash());
 
     return Result::SUCCESS;
 }
@@ -0,0 +1,96 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create Callback Sink compute core using CPU backend.");
+
+    if (!config.dispatch) {
+        return Result::SUCCESS;
+    }
+
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    running = true;
+
+    dispatcher = std::thread([&]{
+        dispatcherLoop();
+    });
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Callback Sink compute core using CPU backend.");
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+    produced.notify_all();
+    consumed.notify_all();
+
+    if (dispatcher.joinable()) {
+        dispatcher.join();
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::compute(const RuntimeMetadata&) {
+    if (!config.dispatch) {
+        callback(input.buffer);
+        return Result::SUCCESS;
+    }
+
+    // Wait for a free slot or drop the frame.
+
+    const U64 position = head.load(std::memory_order_relaxed);
+
+    if (position - tail.load(std::memory_order_acquire) >= slots.size()) {
+        if (!blocking) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            droppedCounter->increment();
+            return Result::SUCCESS;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        consumed.wait(lock, [&]{
+            return !running || position - tail.load(std::memory_order_acquire) < slots.size();
+        });
+
+        if (!running) {
+            return Result::SUCCESS;
+        }
+    }
+
+    // Copy the frame. The input is overwritten by the next one.
+
+    auto& slot = slots[position % slots.size()];
+
+    if (input.buffer.contiguous()) {
+        std::copy(input.buffer.begin(), input.buffer.end(), slot.begin());
+    } else {
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in;
+        }, input.buffer, slot);
+    }
+
+    head.store(position + 1, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+    produced.notify_one();
+
+    return Result::SUCCESS;
+}
+
+JST_CALLBACK_SINK_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
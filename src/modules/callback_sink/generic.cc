@@ -0,0 +1,127 @@
+#include <unordered_map>
+
+#include "jetstream/modules/callback_sink.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+static std::unordered_map<std::string, typename CallbackSink<D, T>::Callback>& CallbackRegistry() {
+    static std::unordered_map<std::string, typename CallbackSink<D, T>::Callback> registry;
+    return registry;
+}
+
+static std::mutex& CallbackRegistryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::RegisterCallback(const std::string& name, const Callback& callback) {
+    if (name.empty() || !callback) {
+        JST_ERROR("[CALLBACK_SINK] Callback needs a name and a function.");
+        return Result::ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(CallbackRegistryMutex());
+    CallbackRegistry<D, T>()[name] = callback;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::RemoveCallback(const std::string& name) {
+    std::lock_guard<std::mutex> lock(CallbackRegistryMutex());
+    CallbackRegistry<D, T>().erase(name);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CallbackSink<D, T>::create() {
+    JST_DEBUG("Initializing Callback Sink module.");
+    JST_INIT_IO();
+
+    // Resolve callback.
+
+    callback = config.callback;
+
+    if (!callback && !config.name.empty()) {
+        std::lock_guard<std::mutex> lock(CallbackRegistryMutex());
+        const auto& registry = CallbackRegistry<D, T>();
+        if (registry.contains(config.name)) {
+            callback = registry.at(config.name);
+        }
+    }
+
+    if (!callback) {
+        JST_ERROR("No callback registered with the name '{}'.", config.name);
+        return Result::ERROR;
+    }
+
+    // Check parameters.
+
+    if (config.policy != "drop" && config.policy != "block") {
+        JST_ERROR("Invalid policy '{}'. It should be 'drop' or 'block'.", config.policy);
+        return Result::ERROR;
+    }
+    blocking = config.policy == "block";
+
+    if (config.dispatch && config.queueDepth == 0) {
+        JST_ERROR("Queue depth should be larger than zero.");
+        return Result::ERROR;
+    }
+
+    // Allocate slots for the dispatcher.
+
+    slots.clear();
+    if (config.dispatch) {
+        for (U64 i = 0; i < config.queueDepth; i++) {
+            slots.push_back(Tensor<D, T>(input.buffer.shape()));
+        }
+    }
+
+    droppedCounter = &Metrics::GetCounter("jetstream_callback_sink_dropped_frames_total",
+                                          "Number of frames dropped because the dispatcher queue was full.",
+                                          fmt::format("module=\"{}\"", locale().shash()));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void CallbackSink<D, T>::info() const {
+    JST_INFO("  Name:        {}", config.name.empty() ? "(direct)" : config.name);
+    JST_INFO("  Dispatch:    {}", config.dispatch ? "YES" : "NO");
+    if (config.dispatch) {
+        JST_INFO("  Queue Depth: {}", config.queueDepth);
+        JST_INFO("  Policy:      {}", config.policy);
+    }
+}
+
+template<Device D, typename T>
+void CallbackSink<D, T>::dispatcherLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            produced.wait(lock, [&]{
+                return !running || head.load(std::memory_order_acquire) != tail.load(std::memory_order_relaxed);
+            });
+
+            if (!running) {
+                return;
+            }
+        }
+
+        const U64 end = head.load(std::memory_order_acquire);
+        for (U64 i = tail.load(std::memory_order_relaxed); i < end; i++) {
+            callback(slots[i % slots.size()]);
+            tail.store(i + 1, std::memory_order_release);
+        }
+
+        if (blocking) {
+            std::lock_guard<std::mutex> lock(mutex);
+            consumed.notify_one();
+        }
+    }
+}
+
+}  // namespace Jetstream
@@ -7,6 +7,13 @@ Result Cast<D, IT, OT>::create() {
     JST_DEBUG("Initializing Cast module.");
     JST_INIT_IO();
 
+    // Check parameters.
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
     // Configure scaler.
 
     if (config.scaler == 0.0f) {
@@ -0,0 +1,24 @@
+#include "jetstream/modules/cfar.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192 CA", {
+        .mode = "ca" COMMA
+        .training = 16 COMMA
+        .guard = 2 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x8192 OS", {
+        .mode = "os" COMMA
+        .training = 16 COMMA
+        .guard = 2 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,161 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result CFAR<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create CFAR compute core using CPU backend.");
+
+    cpu.prefix.resize(numberOfBins + 1);
+    cpu.noise.resize(numberOfBins);
+    cpu.cells.resize(2 * config.training);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CFAR<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy CFAR compute core using CPU backend.");
+
+    cpu.prefix.clear();
+    cpu.noise.clear();
+    cpu.cells.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CFAR<D, T>::compute(const RuntimeMetadata&) {
+    const U64 bins = numberOfBins;
+    const U64 guard = config.guard;
+    const U64 training = config.training;
+    const U64 reach = guard + training;
+
+    F64* prefix = cpu.prefix.data();
+    F32* noise = cpu.noise.data();
+
+    // Training cells of a bin. Windows are cut at the edges.
+
+    const auto window = [&](const U64& i, U64& leftBegin, U64& leftEnd, U64& rightBegin, U64& rightEnd) {
+        leftBegin = (i > reach) ? i - reach : 0;
+        leftEnd = (i > guard) ? i - guard : 0;
+        rightBegin = std::min(i + guard + 1, bins);
+        rightEnd = std::min(i + reach + 1, bins);
+    };
+
+    for (U64 b = 0; b < numberOfBatches; b++) {
+        const F32* power = input.buffer.data() + b * bins;
+        F32* detections = output.detections.data() + b * config.maxDetections * 3;
+
+        if (!orderedStatistic) {
+            // Window sums of the linear power from a running sum in double
+            // precision. The mean goes back to dB for the comparison. A mean
+            // lost to rounding (over ~150 dB below the batch total) counts as
+            // no noise estimate.
+
+            prefix[0] = 0.0;
+            for (U64 i = 0; i < bins; i++) {
+                prefix[i + 1] = prefix[i] + std::pow(10.0, power[i] / 10.0);
+            }
+
+            const auto toDecibel = [&](const U64& i, const F64& mean) {
+                noise[i] = (mean > 0.0) ? static_cast<F32>(10.0 * std::log10(mean)) : power[i];
+            };
+
+            const auto average = [&](const U64& i) {
+                U64 leftBegin, leftEnd, rightBegin, rightEnd;
+                window(i, leftBegin, leftEnd, rightBegin, rightEnd);
+
+                const U64 count = (leftEnd - leftBegin) + (rightEnd - rightBegin);
+                const F64 sum = (prefix[leftEnd] - prefix[leftBegin]) + (prefix[rightEnd] - prefix[rightBegin]);
+                if (count > 0) {
+                    toDecibel(i, sum / count);
+                } else {
+                    noise[i] = power[i];
+                }
+            };
+
+            // Full windows have a constant count.
+
+            const U64 begin = std::min(reach, bins);
+            const U64 end = (bins > reach) ? std::max(bins - reach, begin) : begin;
+            const F64 scale = 1.0 / (2.0 * training);
+
+            for (U64 i = 0; i < begin; i++) {
+                average(i);
+            }
+            for (U64 i = begin; i < end; i++) {
+                const F64 sum = (prefix[i - guard] - prefix[i - reach]) +
+                                (prefix[i + reach + 1] - prefix[i + guard + 1]);
+                toDecibel(i, sum * scale);
+            }
+            for (U64 i = end; i < bins; i++) {
+                average(i);
+            }
+        } else {
+            for (U64 i = 0; i < bins; i++) {
+                U64 leftBegin, leftEnd, rightBegin, rightEnd;
+                window(i, leftBegin, leftEnd, rightBegin, rightEnd);
+
+                auto* cells = cpu.cells.data();
+                const auto last = std::copy(power + rightBegin, power + rightEnd,
+                                            std::copy(power + leftBegin, power + leftEnd, cells));
+                const U64 count = last - cells;
+
+                if (count == 0) {
+                    noise[i] = power[i];
+                    continue;
+                }
+
+                const U64 k = static_cast<U64>(config.rank * static_cast<F32>(count - 1));
+                std::nth_element(cells, cells + k, last);
+                noise[i] = cells[k];
+            }
+        }
+
+        // Report the strongest bin of each run above the threshold.
+
+        U64 count = 0;
+        bool inside = false;
+        U64 peak = 0;
+
+        const auto emit = [&]() {
+            if (count < config.maxDetections) {
+                detections[count * 3 + 0] = static_cast<F32>(peak);
+                detections[count * 3 + 1] = power[peak];
+                detections[count * 3 + 2] = power[peak] - noise[peak];
+                count++;
+            }
+        };
+
+        for (U64 i = 0; i < bins; i++) {
+            if (power[i] - noise[i] > config.threshold) {
+                if (!inside || power[i] > power[peak]) {
+                    peak = i;
+                }
+                inside = true;
+            } else if (inside) {
+                emit();
+                inside = false;
+            }
+        }
+        if (inside) {
+            emit();
+        }
+
+        for (U64 i = count; i < config.maxDetections; i++) {
+            detections[i * 3 + 0] = -1.0f;
+            detections[i * 3 + 1] = 0.0f;
+            detections[i * 3 + 2] = 0.0f;
+        }
+
+        output.count[b] = count;
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_CFAR_CPU(JST_INSTANTIATION)
+JST_CFAR_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
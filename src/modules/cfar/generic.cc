@@ -0,0 +1,77 @@
+#include "jetstream/modules/cfar.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result CFAR<D, T>::create() {
+    JST_DEBUG("Initializing CFAR module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.rank() == 0 || input.buffer.rank() > 2) {
+        JST_ERROR("Input should be {{bins}} or {{batch, bins}}, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (input.buffer.size() == 0) {
+        JST_ERROR("Input should not be empty, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
+    if (config.mode != "ca" && config.mode != "os") {
+        JST_ERROR("Unknown mode '{}'. Expected 'ca' or 'os'.", config.mode);
+        return Result::ERROR;
+    }
+    orderedStatistic = (config.mode == "os");
+
+    if (config.training == 0 || config.maxDetections == 0) {
+        JST_ERROR("Training cells ({}) and maximum detections ({}) should be larger than zero.", config.training,
+                                                                                               config.maxDetections);
+        return Result::ERROR;
+    }
+
+    if (config.rank < 0.0f || config.rank > 1.0f) {
+        JST_ERROR("Rank ({}) should be between zero and one.", config.rank);
+        return Result::ERROR;
+    }
+
+    numberOfBins = input.buffer.shape()[input.buffer.rank() - 1];
+    numberOfBatches = input.buffer.size() / numberOfBins;
+
+    // Allocate output.
+
+    std::vector<U64> shape = {config.maxDetections, 3};
+    if (input.buffer.rank() == 2) {
+        shape.insert(shape.begin(), numberOfBatches);
+    }
+    output.detections = Tensor<D, T>(shape);
+    output.count = Tensor<D, U64>({numberOfBatches});
+
+    output.detections.attribute("columns").set(std::vector<std::string>{"bin", "power", "snr"});
+    output.detections.attribute("mode").set(config.mode);
+    output.detections.attribute("threshold").set(config.threshold);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void CFAR<D, T>::info() const {
+    JST_INFO("  Mode:           {}", config.mode);
+    JST_INFO("  Training Cells: {}", config.training);
+    JST_INFO("  Guard Cells:    {}", config.guard);
+    JST_INFO("  Threshold:      {:.2f} dB", config.threshold);
+    if (orderedStatistic) {
+        JST_INFO("  Rank:           {:.2f}", config.rank);
+    }
+    JST_INFO("  Max Detections: {}", config.maxDetections);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,30 @@
+#include "jetstream/modules/cic.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x65536 R256 Integer", {
+        .decimation = 256 COMMA
+        .integer = true COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 65536}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x65536 R256 Float", {
+        .decimation = 256 COMMA
+        .integer = false COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 65536}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x65536 R256 Integer Compensated", {
+        .decimation = 256 COMMA
+        .integer = true COMMA
+        .compensationTaps = 31 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 65536}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,254 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result CIC<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create CIC compute core using CPU backend.");
+
+    const U64 channels = numberOfChannels;
+    const U64 lanes = 2 * channels;
+    const U64 length = config.decimation * config.delay;
+
+    if (config.integer) {
+        cpu.integrators.resize(config.stages * lanes, 0);
+        cpu.combs.resize(config.stages * config.delay * lanes, 0);
+        cpu.stage.resize(lanes, 0);
+        cpu.quantization = std::ldexp(1.0, 62 - registerGrowth);
+        cpu.historyCarry = 0;
+    } else {
+        // The response is a boxcar of decimation · delay samples convolved
+        // with itself once per stage.
+
+        std::vector<F64> response = {1.0};
+
+        for (U64 s = 0; s < config.stages; s++) {
+            std::vector<F64> next(response.size() + length - 1, 0.0);
+            for (U64 i = 0; i < response.size(); i++) {
+                for (U64 j = 0; j < length; j++) {
+                    next[i + j] += response[i];
+                }
+            }
+            response = std::move(next);
+        }
+
+        const F64 gain = std::pow(static_cast<F64>(length), static_cast<F64>(config.stages));
+
+        cpu.response.resize(response.size());
+        for (U64 i = 0; i < response.size(); i++) {
+            cpu.response[i] = static_cast<F32>(response[i] / gain);
+        }
+        cpu.historyCarry = response.size() - 1;
+    }
+
+    cpu.history.resize((cpu.historyCarry + numberOfSamples) * channels, CF32(0.0f, 0.0f));
+
+    // The compensation inverts the droop of the response up to the passband.
+    // It is sampled on a dense grid and windowed like the Filter taps.
+
+    const U64 outputSamples = numberOfSamples / config.decimation;
+    const U64 taps = config.compensationTaps;
+
+    if (taps > 0) {
+        const auto droop = [&](const F64& f) {
+            if (f == 0.0) {
+                return 1.0;
+            }
+            const F64 ratio = std::sin(JST_PI * config.delay * f) /
+                              (length * std::sin(JST_PI * f / config.decimation));
+            return std::pow(std::max(std::abs(ratio), 1e-3), static_cast<F64>(config.stages));
+        };
+
+        constexpr U64 grid = 1024;
+        const F64 step = config.passband / grid;
+        const F64 center = (taps - 1) / 2.0;
+
+        std::vector<F64> compensation(taps, 0.0);
+        F64 sum = 0.0;
+
+        for (U64 i = 0; i < taps; i++) {
+            for (U64 g = 0; g < grid; g++) {
+                const F64 f = (g + 0.5) * step;
+                compensation[i] += 2.0 * step * std::cos(2.0 * JST_PI * f * (i - center)) / droop(f);
+            }
+            compensation[i] *= 0.42 - 0.50 * std::cos(2.0 * JST_PI * i / (taps - 1)) +
+                               0.08 * std::cos(4.0 * JST_PI * i / (taps - 1));
+            sum += compensation[i];
+        }
+
+        cpu.compensation.resize(taps);
+        for (U64 i = 0; i < taps; i++) {
+            cpu.compensation[i] = static_cast<F32>(compensation[i] / sum);
+        }
+
+        cpu.decimatedCarry = taps - 1;
+        cpu.compensated.resize(outputSamples * channels);
+    } else {
+        cpu.decimatedCarry = 0;
+    }
+
+    cpu.decimated.resize((cpu.decimatedCarry + outputSamples) * channels, CF32(0.0f, 0.0f));
+    cpu.cursor = 0;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CIC<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy CIC compute core using CPU backend.");
+
+    cpu.history.clear();
+    cpu.decimated.clear();
+    cpu.compensated.clear();
+    cpu.integrators.clear();
+    cpu.combs.clear();
+    cpu.stage.clear();
+    cpu.response.clear();
+    cpu.compensation.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result CIC<D, T>::compute(const RuntimeMetadata&) {
+    const U64 channels = numberOfChannels;
+    const U64 lanes = 2 * channels;
+    const U64 samples = numberOfSamples;
+    const U64 decimation = config.decimation;
+    const U64 stages = config.stages;
+    const U64 outputSamples = samples / decimation;
+
+    // Keep the tails of the previous frame and lay the new samples out with
+    // the channels side by side.
+
+    CF32* history = cpu.history.data();
+    CF32* decimated = cpu.decimated.data();
+
+    std::copy(history + samples * channels, history + (cpu.historyCarry + samples) * channels, history);
+    std::copy(decimated + outputSamples * channels,
+              decimated + (cpu.decimatedCarry + outputSamples) * channels,
+              decimated);
+
+    Memory::CPU::BlockedTranspose(input.buffer.data(),
+                                  history + cpu.historyCarry * channels,
+                                  channels,
+                                  samples,
+                                  samples,
+                                  channels);
+
+    // Both modes clamp the input to the full scale of one.
+
+    F32* fresh = reinterpret_cast<F32*>(history + cpu.historyCarry * channels);
+    for (U64 i = 0; i < samples * lanes; i++) {
+        fresh[i] = std::clamp(fresh[i], -1.0f, 1.0f);
+    }
+
+    const F32* x = reinterpret_cast<const F32*>(history);
+    F32* y = reinterpret_cast<F32*>(decimated + cpu.decimatedCarry * channels);
+
+    if (config.integer) {
+        U64* integrators = cpu.integrators.data();
+        U64* combs = cpu.combs.data();
+        U64* stage = cpu.stage.data();
+
+        const F64 quantization = cpu.quantization;
+        const F64 gain = 1.0 / (quantization * std::pow(static_cast<F64>(decimation * config.delay),
+                                                        static_cast<F64>(stages)));
+
+        for (U64 o = 0; o < outputSamples; o++) {
+            for (U64 r = 0; r < decimation; r++) {
+                const F32* v = x + (o * decimation + r) * lanes;
+
+                for (U64 k = 0; k < lanes; k++) {
+                    const F64 sample = static_cast<F64>(v[k]) * quantization;
+                    integrators[k] += static_cast<U64>(static_cast<I64>(sample));
+                }
+                for (U64 s = 1; s < stages; s++) {
+                    U64* integrator = integrators + s * lanes;
+                    const U64* previous = integrator - lanes;
+                    for (U64 k = 0; k < lanes; k++) {
+                        integrator[k] += previous[k];
+                    }
+                }
+            }
+
+            // Combs share one ring cursor holding the value from delay
+            // outputs ago.
+
+            std::copy(integrators + (stages - 1) * lanes, integrators + stages * lanes, stage);
+
+            for (U64 s = 0; s < stages; s++) {
+                U64* comb = combs + (s * config.delay + cpu.cursor) * lanes;
+                for (U64 k = 0; k < lanes; k++) {
+                    const U64 value = stage[k];
+                    stage[k] = value - comb[k];
+                    comb[k] = value;
+                }
+            }
+
+            F32* out = y + o * lanes;
+            for (U64 k = 0; k < lanes; k++) {
+                out[k] = static_cast<F32>(static_cast<F64>(static_cast<I64>(stage[k])) * gain);
+            }
+
+            cpu.cursor = (cpu.cursor + 1) % config.delay;
+        }
+    } else {
+        const F32* response = cpu.response.data();
+        const U64 length = cpu.response.size();
+
+        for (U64 o = 0; o < outputSamples; o++) {
+            F32* out = y + o * lanes;
+            std::fill(out, out + lanes, 0.0f);
+
+            // The newest sample of the block meets the first coefficient.
+
+            const F32* newest = x + (cpu.historyCarry + o * decimation + decimation - 1) * lanes;
+
+            for (U64 j = 0; j < length; j++) {
+                const F32* v = newest - j * lanes;
+                const F32 h = response[j];
+                for (U64 k = 0; k < lanes; k++) {
+                    out[k] += h * v[k];
+                }
+            }
+        }
+    }
+
+    const CF32* result = decimated + cpu.decimatedCarry * channels;
+
+    if (config.compensationTaps > 0) {
+        const F32* d = reinterpret_cast<const F32*>(decimated);
+        F32* z = reinterpret_cast<F32*>(cpu.compensated.data());
+        const F32* compensation = cpu.compensation.data();
+        const U64 taps = config.compensationTaps;
+
+        for (U64 o = 0; o < outputSamples; o++) {
+            F32* out = z + o * lanes;
+            std::fill(out, out + lanes, 0.0f);
+
+            const F32* newest = d + (cpu.decimatedCarry + o) * lanes;
+
+            for (U64 t = 0; t < taps; t++) {
+                const F32* v = newest - t * lanes;
+                const F32 g = compensation[t];
+                for (U64 k = 0; k < lanes; k++) {
+                    out[k] += g * v[k];
+                }
+            }
+        }
+
+        result = cpu.compensated.data();
+    }
+
+    Memory::CPU::BlockedTranspose(result, output.buffer.data(), outputSamples, channels, channels, outputSamples);
+
+    return Result::SUCCESS;
+}
+
+JST_CIC_CPU(JST_INSTANTIATION)
+JST_CIC_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
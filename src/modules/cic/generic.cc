@@ -0,0 +1,99 @@
+#include <cmath>
+
+#include "jetstream/modules/cic.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result CIC<D, T>::create() {
+    JST_DEBUG("Initializing CIC module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.rank() == 0 || input.buffer.rank() > 2) {
+        JST_ERROR("Input should be {{samples}} or {{batch, samples}}, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (input.buffer.size() == 0) {
+        JST_ERROR("Input should not be empty, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
+    if (config.decimation == 0 || config.stages == 0 || config.delay == 0) {
+        JST_ERROR("Decimation ({}), stages ({}) and delay ({}) should be larger than zero.", config.decimation,
+                                                                                           config.stages,
+                                                                                           config.delay);
+        return Result::ERROR;
+    }
+
+    if (config.compensationTaps != 0 && (config.compensationTaps % 2 == 0 || config.compensationTaps < 3)) {
+        JST_ERROR("Invalid number of compensation taps: '{}'. Number of taps should be zero or odd and "
+                  "at least three.", config.compensationTaps);
+        return Result::ERROR;
+    }
+
+    if (config.passband <= 0.0f || config.passband > 0.5f) {
+        JST_ERROR("Passband ({}) should be larger than zero and at most half the output sample rate.",
+                  config.passband);
+        return Result::ERROR;
+    }
+
+    numberOfSamples = input.buffer.shape()[input.buffer.rank() - 1];
+    numberOfChannels = input.buffer.size() / numberOfSamples;
+
+    if (numberOfSamples % config.decimation != 0) {
+        JST_ERROR("Number of input samples ({}) should be a multiple of the decimation ({}).", numberOfSamples,
+                                                                                             config.decimation);
+        return Result::ERROR;
+    }
+
+    // The registers grow by stages · log2(decimation · delay) bits.
+
+    registerGrowth = config.stages * static_cast<U64>(std::ceil(std::log2(config.decimation * config.delay)));
+
+    if (config.integer && registerGrowth + 12 > 63) {
+        JST_ERROR("Register growth ({} bits) leaves less than 12 bits for the input. "
+                  "Use fewer stages or the float mode.", registerGrowth);
+        return Result::ERROR;
+    }
+
+    // Allocate output.
+
+    std::vector<U64> shape = {numberOfSamples / config.decimation};
+    if (input.buffer.rank() == 2) {
+        shape.insert(shape.begin(), numberOfChannels);
+    }
+    output.buffer = Tensor<D, T>(shape);
+
+    output.buffer.attribute("decimation").set(config.decimation);
+    if (input.buffer.attributes().contains("sample_rate")) {
+        const F32& sampleRate = input.buffer.attribute("sample_rate").template get<F32>();
+        output.buffer.attribute("sample_rate").set(sampleRate / static_cast<F32>(config.decimation));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void CIC<D, T>::info() const {
+    JST_INFO("  Decimation:        {}", config.decimation);
+    JST_INFO("  Stages:            {}", config.stages);
+    JST_INFO("  Delay:             {}", config.delay);
+    JST_INFO("  Arithmetic:        {}", config.integer ? "INTEGER" : "FLOAT");
+    JST_INFO("  Register Growth:   {} bits", registerGrowth);
+    JST_INFO("  Compensation Taps: {}", config.compensationTaps);
+    if (config.compensationTaps > 0) {
+        JST_INFO("  Passband:          {:.2f}", config.passband);
+    }
+}
+
+}  // namespace Jetstream
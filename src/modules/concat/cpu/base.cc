@@ -0,0 +1,48 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Concat<D, T>::placeInputs(const std::unordered_set<std::string>& inputs,
+                                 std::unordered_map<std::string, void*>& addresses) {
+    // Only dense slots can hold the memory of a producer.
+
+    const auto place = [&](const std::string& name, Tensor<D, T>& buffer, Tensor<D, T>& slot, bool& placed) {
+        if (!inputs.contains(name) || !slot.contiguous()) {
+            return;
+        }
+
+        if (buffer.place(slot) == Result::SUCCESS) {
+            placed = true;
+            addresses[name] = buffer.data();
+        }
+    };
+
+    place("bufferA", input.bufferA, slotA, placedA);
+    place("bufferB", input.bufferB, slotB, placedB);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Concat<D, T>::compute(const RuntimeMetadata&) {
+    const auto copy = [](const auto& in, auto& out) {
+        out = in;
+    };
+
+    if (!placedA) {
+        Memory::CPU::AutomaticIterator(copy, input.bufferA, slotA);
+    }
+
+    if (!placedB) {
+        Memory::CPU::AutomaticIterator(copy, input.bufferB, slotB);
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_CONCAT_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -0,0 +1,78 @@
+#include "jetstream/modules/concat.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Concat<D, T>::create() {
+    JST_DEBUG("Initializing Concat module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    const auto& shapeA = input.bufferA.shape();
+    const auto& shapeB = input.bufferB.shape();
+    const U64 rank = shapeA.size();
+
+    if (shapeB.size() != rank) {
+        JST_ERROR("Inputs A {} and B {} should have the same rank.", shapeA, shapeB);
+        return Result::ERROR;
+    }
+
+    if (config.axis > rank || (!config.stack && config.axis == rank)) {
+        JST_ERROR("Axis ({}) is out of bounds for inputs with rank {}.", config.axis, rank);
+        return Result::ERROR;
+    }
+
+    for (U64 i = 0; i < rank; i++) {
+        if (shapeA[i] != shapeB[i] && (config.stack || i != config.axis)) {
+            JST_ERROR("Inputs A {} and B {} can't be {} along axis {}.", shapeA, shapeB,
+                                                                       config.stack ? "stacked" : "concatenated",
+                                                                       config.axis);
+            return Result::ERROR;
+        }
+    }
+
+    // Allocate output.
+
+    std::vector<U64> shape = shapeA;
+
+    if (config.stack) {
+        shape.insert(shape.begin() + config.axis, 2);
+    } else {
+        shape[config.axis] += shapeB[config.axis];
+    }
+
+    output.buffer = Tensor<D, T>(shape);
+
+    // Each input is a view of its slot in the output.
+
+    std::vector<Token> tokensA(shape.size());
+    std::vector<Token> tokensB(shape.size());
+
+    if (config.stack) {
+        tokensA[config.axis] = Token(static_cast<U64>(0));
+        tokensB[config.axis] = Token(static_cast<U64>(1));
+    } else {
+        tokensA[config.axis] = Token(static_cast<U64>(0), shapeA[config.axis]);
+        tokensB[config.axis] = Token(shapeA[config.axis], shape[config.axis]);
+    }
+
+    slotA = output.buffer;
+    slotB = output.buffer;
+    JST_CHECK(slotA.view(tokensA));
+    JST_CHECK(slotB.view(tokensB));
+
+    placedA = false;
+    placedB = false;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Concat<D, T>::info() const {
+    JST_INFO("  Axis:   {}", config.axis);
+    JST_INFO("  Stack:  {}", config.stack ? "YES" : "NO");
+    JST_INFO("  Placed: A ({}), B ({})", placedA ? "YES" : "NO", placedB ? "YES" : "NO");
+}
+
+}  // namespace Jetstream
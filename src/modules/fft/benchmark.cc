@@ -1,4 +1,10 @@
+#include <random>
+
 #include "jetstream/modules/fft.hh"
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/amplitude.hh"
+#include "jetstream/modules/scale.hh"
+#include "jetstream/modules/fused.hh"
 
 namespace Jetstream {
 
@@ -15,6 +21,130 @@ void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
     }, {
         .buffer = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
     }, T);
+
+    if constexpr (D == Device::CPU) {
+        JST_BENCHMARK_RUN("8000x128 Forward Axis 0", {
+            .forward = true COMMA
+            .axes = {0} COMMA
+        }, {
+            .buffer = Tensor<D COMMA T>({8000 COMMA 128}) COMMA
+        }, T);
+
+        JST_BENCHMARK_RUN("8000x1024 Forward Axis 0", {
+            .forward = true COMMA
+            .axes = {0} COMMA
+        }, {
+            .buffer = Tensor<D COMMA T>({8000 COMMA 1024}) COMMA
+        }, T);
+
+        JST_BENCHMARK_RUN("1024x1024 Forward 2D", {
+            .forward = true COMMA
+            .axes = {0 COMMA 1} COMMA
+        }, {
+            .buffer = Tensor<D COMMA T>({1024 COMMA 1024}) COMMA
+        }, T);
+    }
+
+#if defined(JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_AMPLITUDE_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_SCALE_CPU_AVAILABLE)
+
+    // Spectrum chain of the hello world example (window multiply, FFT, amplitude,
+    // scale) as separate runtime modules and as fused elementwise stages. The
+    // fused graph skips the product and amplitude tensors of the runtime graph.
+
+    if constexpr (D == Device::CPU && std::is_same_v<T, CF32>) {
+        const U64 batches = 8;
+        const U64 size = 8192;
+
+        Tensor<D, CF32> signal({batches, size});
+        Tensor<D, CF32> window({size});
+
+        std::mt19937 generator(42);
+        std::normal_distribution<F32> noise(0.0f, 1.0f);
+        for (U64 i = 0; i < signal.size(); i++) {
+            signal.data()[i] = CF32(noise(generator), noise(generator));
+        }
+        for (U64 i = 0; i < size; i++) {
+            window.data()[i] = 0.5f - 0.5f * std::cos(2.0f * JST_PI * i / (size - 1));
+        }
+
+        const auto run = [&](const std::string& label,
+                             const std::vector<std::shared_ptr<Compute>>& modules,
+                             const U64& bytes,
+                             const F64& flops) {
+            auto graph = NewGraph(D);
+            for (const auto& module : modules) {
+                graph->setModule(module);
+            }
+            graph->create();
+
+            U64 calls = 0;
+            Benchmark::CountersBegin();
+            bench.run(name + label, [&] {
+                graph->compute();
+                calls++;
+            });
+            Benchmark::CountersEnd(name + label, calls);
+            Benchmark::SetWorkload(name + label, bytes, flops);
+
+            graph->destroy();
+        };
+
+        // Runtime graph.
+
+        {
+            auto multiply = std::make_shared<Multiply<D, CF32>>();
+            multiply->init_benchmark_mode({}, { .factorA = signal, .factorB = window });
+            multiply->create();
+
+            auto fft = std::make_shared<Module<D, CF32>>();
+            fft->init_benchmark_mode({ .forward = true }, { .buffer = multiply->getOutputProduct() });
+            fft->create();
+
+            auto amplitude = std::make_shared<Amplitude<D, CF32>>();
+            amplitude->init_benchmark_mode({}, { .buffer = fft->getOutputBuffer() });
+            amplitude->create();
+
+            auto scale = std::make_shared<Scale<D, F32>>();
+            scale->init_benchmark_mode({ .range = {-100.0f, 0.0f} }, { .buffer = amplitude->getOutputBuffer() });
+            scale->create();
+
+            const U64 bytes = multiply->benchmark_bytes() + fft->benchmark_bytes() +
+                              amplitude->benchmark_bytes() + scale->benchmark_bytes();
+            const F64 flops = multiply->benchmark_flops() + fft->benchmark_flops();
+
+            run("8x8192 Spectrum Runtime Graph", {multiply, fft, amplitude, scale}, bytes, flops);
+        }
+
+        // Fused graph.
+
+        {
+            using Pre = Elementwise::Multiply<CF32>;
+            using Post = Elementwise::Chain<Elementwise::Amplitude<>, Elementwise::Scale>;
+
+            auto pre = std::make_shared<Fused<D, Pre>>();
+            pre->init_benchmark_mode({ .pipeline = Pre(window) }, { .buffer = signal });
+            pre->create();
+
+            auto fft = std::make_shared<Module<D, CF32>>();
+            fft->init_benchmark_mode({ .forward = true }, { .buffer = pre->getOutputBuffer() });
+            fft->create();
+
+            auto post = std::make_shared<Fused<D, Post>>();
+            post->init_benchmark_mode({ .pipeline = Elementwise::Amplitude() | Elementwise::Scale({-100.0f, 0.0f}) },
+                                      { .buffer = fft->getOutputBuffer() });
+            post->create();
+
+            const U64 bytes = pre->benchmark_bytes() + window.size_bytes() +
+                              fft->benchmark_bytes() + post->benchmark_bytes();
+            const F64 flops = 6.0 * signal.size() + fft->benchmark_flops();
+
+            run("8x8192 Spectrum Fused", {pre, fft, post}, bytes, flops);
+        }
+    }
+
+#endif
 }
 
-}  // namespace Jetstream
\ No newline at end of file
+}  // namespace Jetstream
@@ -1,17 +1,44 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
+// Transforms along axes whose stride spans a page or more are run on a
+// transposed copy. Strided transforms on those axes miss the TLB on every
+// element.
+
+static constexpr U64 FFTTransposeStrideBytes = 4096;
+
 template<>
 Result FFT<Device::CPU, CF32>::createCompute(const RuntimeMetadata&) {
     JST_TRACE("Create FFT compute core using CPU backend.");
 
+    // Strided inputs, like overlapping frames, are read in place.
+
     for (U64 i = 0; i < input.buffer.rank(); ++i) {
         cpu.shape.push_back(static_cast<U32>(input.buffer.shape()[i]));
-        cpu.stride.push_back(static_cast<U32>(input.buffer.stride()[i]) * sizeof(std::complex<F32>));
+        cpu.inputStride.push_back(static_cast<U32>(input.buffer.stride()[i]) * sizeof(std::complex<F32>));
+        cpu.outputStride.push_back(static_cast<U32>(output.buffer.stride()[i]) * sizeof(std::complex<F32>));
+    }
+
+    // Pick a strategy per axis. Only dense sources can be transposed. The
+    // first axis reads the input, the others read the output.
+
+    bool transposing = false;
+
+    for (U64 i = 0; i < axes.size(); i++) {
+        const bool dense = (i == 0) ? input.buffer.contiguous() : true;
+        const auto& stride = (i == 0) ? input.buffer.stride() : output.buffer.stride();
+        const bool large = stride[axes[i]] * sizeof(CF32) >= FFTTransposeStrideBytes;
+
+        cpu.transposed.push_back(dense && large);
+        transposing |= cpu.transposed.back();
     }
 
-    cpu.axes.push_back(output.buffer.rank() - 1);
+    if (transposing) {
+        cpu.scratch = Tensor<Device::CPU, CF32>({output.buffer.size()});
+    }
 
     return Result::SUCCESS;
 }
@@ -21,22 +48,70 @@ Result FFT<Device::CPU, CF32>::destroyCompute(const RuntimeMetadata&) {
     JST_TRACE("Destroy FFT compute core using CPU backend.");
 
     cpu.shape.clear();
-    cpu.stride.clear();
-    cpu.axes.clear();
+    cpu.inputStride.clear();
+    cpu.outputStride.clear();
+    cpu.transposed.clear();
+    cpu.scratch = Tensor<Device::CPU, CF32>();
 
     return Result::SUCCESS;
 }
 
 template<>
 Result FFT<Device::CPU, CF32>::compute(const RuntimeMetadata&) {
-    pocketfft::c2c(cpu.shape, 
-                   cpu.stride, 
-                   cpu.stride, 
-                   cpu.axes, 
-                   config.forward, 
-                   input.buffer.data(), 
-                   output.buffer.data(), 
-                   1.0f);
+    const CF32* src = input.buffer.data();
+    CF32* dst = output.buffer.data();
+
+    for (U64 i = 0; i < axes.size(); i++) {
+        const U64& axis = axes[i];
+        const auto& srcStride = (i == 0) ? cpu.inputStride : cpu.outputStride;
+
+        if (!cpu.transposed[i]) {
+            pocketfft::c2c(cpu.shape,
+                           srcStride,
+                           cpu.outputStride,
+                           {axis},
+                           config.forward,
+                           src,
+                           dst,
+                           1.0f);
+            src = dst;
+            continue;
+        }
+
+        // Move the axis last, transform contiguous rows and move it back.
+
+        const U64 length = cpu.shape[axis];
+        U64 outer = 1;
+        U64 inner = 1;
+        for (U64 j = 0; j < axis; j++) {
+            outer *= cpu.shape[j];
+        }
+        for (U64 j = axis + 1; j < cpu.shape.size(); j++) {
+            inner *= cpu.shape[j];
+        }
+
+        CF32* tmp = cpu.scratch.data();
+        const U64 block = length * inner;
+
+        for (U64 o = 0; o < outer; o++) {
+            Memory::CPU::BlockedTranspose(src + o * block, tmp + o * block, length, inner, inner, length);
+        }
+
+        pocketfft::c2c({outer * inner, length},
+                       {static_cast<ptrdiff_t>(length * sizeof(CF32)), sizeof(CF32)},
+                       {static_cast<ptrdiff_t>(length * sizeof(CF32)), sizeof(CF32)},
+                       {1},
+                       config.forward,
+                       tmp,
+                       tmp,
+                       1.0f);
+
+        for (U64 o = 0; o < outer; o++) {
+            Memory::CPU::BlockedTranspose(tmp + o * block, dst + o * block, inner, length, length, inner);
+        }
+
+        src = dst;
+    }
 
     return Result::SUCCESS;
 }
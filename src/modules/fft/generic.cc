@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "jetstream/modules/fft.hh"
 
 #include "benchmark.cc"
@@ -9,10 +11,30 @@ Result FFT<D, T>::create() {
     JST_DEBUG("Initializing FFT module.");
     JST_INIT_IO();
 
-    // Calculate parameters.
+    // Resolve axes.
 
     const U64 last_axis = input.buffer.rank() - 1;
 
+    axes = config.axes.empty() ? std::vector<U64>{last_axis} : config.axes;
+
+    for (U64 i = 0; i < axes.size(); i++) {
+        if (axes[i] > last_axis) {
+            JST_ERROR("FFT axis ({}) is larger than the input rank ({}).", axes[i], input.buffer.rank());
+            return Result::ERROR;
+        }
+        if (std::count(axes.begin(), axes.begin() + i, axes[i]) > 0) {
+            JST_ERROR("FFT axis ({}) is repeated.", axes[i]);
+            return Result::ERROR;
+        }
+    }
+
+    if (D != Device::CPU && (axes.size() != 1 || axes[0] != last_axis)) {
+        JST_ERROR("FFT on {} only transforms the last axis.", D);
+        return Result::ERROR;
+    }
+
+    // Calculate parameters.
+
     numberOfElements = input.buffer.shape()[last_axis];
 
     numberOfOperations = 1;
@@ -26,8 +48,6 @@ Result FFT<D, T>::create() {
     JST_TRACE("[FFT] Number of operations: {};", numberOfOperations);
     JST_TRACE("[FFT] Element stride: {};", elementStride);
 
-    // TODO: Implement axis selection for FFT.
-
     // Allocate output.
 
     output.buffer = Tensor<D, T>(input.buffer.shape());
@@ -38,6 +58,7 @@ Result FFT<D, T>::create() {
 template<Device D, typename T>
 void FFT<D, T>::info() const {
     JST_INFO("  Forward: {}", config.forward ? "YES" : "NO");
+    JST_INFO("  Axes:    {}", axes);
 }
 
 }  // namespace Jetstream
@@ -0,0 +1,105 @@
+#include "../generic.cc"
+
+#include "jetstream/backend/devices/vulkan/helpers.hh"
+
+namespace Jetstream {
+
+template<>
+Result FFT<Device::Vulkan, CF32>::createCompute(const RuntimeMetadata& meta) {
+    JST_TRACE("Create FFT compute core using Vulkan backend.");
+
+    auto& assets = vulkan;
+    auto& runtime = meta.vulkan;
+    auto& backend = Backend::State<Device::Vulkan>();
+
+    // Assign buffers to module assets.
+    assets.input = input.buffer.data();
+    assets.output = output.buffer.data();
+    assets.inputSize = input.buffer.size_bytes();
+    assets.outputSize = output.buffer.size_bytes();
+
+    // Create VkFFT instance.
+    assets.app = new VkFFTApplication({});
+    assets.configuration = new VkFFTConfiguration({});
+    assets.configuration->FFTdim = 1;
+    assets.configuration->size[0] = numberOfElements;
+    assets.configuration->physicalDevice = &backend->getPhysicalDevice();
+    assets.configuration->device = &backend->getDevice();
+    assets.configuration->queue = const_cast<VkQueue*>(&runtime.queue);
+    assets.configuration->commandPool = const_cast<VkCommandPool*>(&runtime.commandPool);
+    assets.configuration->fence = const_cast<VkFence*>(&runtime.fence);
+    assets.configuration->doublePrecision = false;
+    assets.configuration->numberBatches = numberOfOperations;
+    assets.configuration->isInputFormatted = 1;
+    assets.configuration->inputBufferSize = &assets.inputSize;
+    assets.configuration->inputBuffer = &assets.input;
+    assets.configuration->bufferSize = &assets.outputSize;
+    assets.configuration->buffer = &assets.output;
+
+    // VkFFT uploads its lookup tables through the graph queue.
+    std::lock_guard<std::mutex> lock(backend->getQueueMutex());
+
+    if (auto res = initializeVkFFT(assets.app, *assets.configuration); res != VKFFT_SUCCESS) {
+        JST_ERROR("Failed to initialize VkFFT: {}", static_cast<int>(res));
+        return Result::ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<>
+Result FFT<Device::Vulkan, CF32>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy FFT compute core using Vulkan backend.");
+
+    auto& assets = vulkan;
+
+    if (!assets.app) {
+        return Result::SUCCESS;
+    }
+
+    deleteVkFFT(assets.app);
+
+    delete assets.configuration;
+    delete assets.app;
+
+    assets.app = nullptr;
+    assets.configuration = nullptr;
+
+    return Result::SUCCESS;
+}
+
+template<>
+Result FFT<Device::Vulkan, CF32>::compute(const RuntimeMetadata& meta) {
+    auto& assets = vulkan;
+    auto& runtime = meta.vulkan;
+
+    assets.commandBuffer = runtime.commandBuffer;
+
+    VkFFTLaunchParams launchParams = {};
+    launchParams.commandBuffer = &assets.commandBuffer;
+
+    const int inverse = config.forward ? -1 : 1;
+    if (auto res = VkFFTAppend(assets.app, inverse, &launchParams); res != VKFFT_SUCCESS) {
+        JST_ERROR("Failed to append to VkFFT: {}", static_cast<int>(res));
+        return Result::ERROR;
+    }
+
+    // Make the transform visible to the next kernel of the graph.
+
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+    vkCmdPipelineBarrier(assets.commandBuffer,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    return Result::SUCCESS;
+}
+
+JST_FFT_VULKAN(JST_INSTANTIATION)
+JST_FFT_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -1,19 +1,45 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
-
 namespace Jetstream {
 
 template<Device D, typename IT, typename OT>
 Result FM<D, IT, OT>::createCompute(const RuntimeMetadata&) {
     JST_TRACE("Create FM compute core.");
+
+    JST_CHECK(Backend::StringToMathAccuracy(config.accuracy, cpu.accuracy));
+
     return Result::SUCCESS;
 }
 
+// Phase difference between consecutive samples, arg(conj(x[n - 1]) * x[n]).
+
+template<Backend::MathAccuracy A>
+static void ComputeFM(const CF32* input, F32* output, const U64& size, const F32& ref) {
+    for (U64 n = 1; n < size; n++) {
+        const CF32& a = input[n - 1];
+        const CF32& b = input[n];
+        const F32 re = a.real() * b.real() + a.imag() * b.imag();
+        const F32 im = a.real() * b.imag() - a.imag() * b.real();
+        output[n] = Backend::Atan2<A>(im, re) * ref;
+    }
+}
+
 template<Device D, typename IT, typename OT>
 Result FM<D, IT, OT>::compute(const RuntimeMetadata&) {
-    for (size_t n = 1; n < input.buffer.size(); n++) {
-        output.buffer[n] = std::arg(std::conj(input.buffer[n - 1]) * input.buffer[n]) * ref;
+    const auto* in = input.buffer.data();
+    auto* out = output.buffer.data();
+    const U64 size = input.buffer.size();
+
+    switch (cpu.accuracy) {
+        case Backend::MathAccuracy::Fast:
+            ComputeFM<Backend::MathAccuracy::Fast>(in, out, size, ref);
+            break;
+        case Backend::MathAccuracy::Balanced:
+            ComputeFM<Backend::MathAccuracy::Balanced>(in, out, size, ref);
+            break;
+        case Backend::MathAccuracy::Exact:
+            ComputeFM<Backend::MathAccuracy::Exact>(in, out, size, ref);
+            break;
     }
 
     return Result::SUCCESS;
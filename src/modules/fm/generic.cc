@@ -22,6 +22,7 @@ Result FM<D, IT, OT>::create() {
 template<Device D, typename IT, typename OT>
 void FM<D, IT, OT>::info() const {
     JST_INFO("  Sample Rate: {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_INFO("  Accuracy:    {}", config.accuracy);
 }
 
 }  // namespace Jetstream
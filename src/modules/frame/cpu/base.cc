@@ -0,0 +1,22 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Frame<D, T>::compute(const RuntimeMetadata&) {
+    if (carry == 0) {
+        return Result::SUCCESS;
+    }
+
+    // Keep the tail of the previous input and append the new one.
+
+    T* data = history.data();
+    std::copy(data + history.size() - carry, data + history.size(), data);
+    std::copy(input.buffer.begin(), input.buffer.end(), data + carry);
+
+    return Result::SUCCESS;
+}
+
+JST_FRAME_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
@@ -0,0 +1,64 @@
+#include "jetstream/modules/frame.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Frame<D, T>::create() {
+    JST_DEBUG("Initializing Frame module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.rank() > 2) {
+        JST_ERROR("Input should be {{samples}} or {{batch, samples}}, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
+    if (config.frameSize == 0 || config.hop == 0) {
+        JST_ERROR("Frame size ({}) and hop ({}) should be larger than zero.", config.frameSize, config.hop);
+        return Result::ERROR;
+    }
+
+    const U64 samples = input.buffer.size();
+
+    if (samples % config.hop != 0) {
+        JST_ERROR("Number of input samples ({}) should be a multiple of the hop ({}).", samples, config.hop);
+        return Result::ERROR;
+    }
+
+    if (config.frameSize > config.hop + samples) {
+        JST_ERROR("Frame size ({}) is larger than the hop plus the input ({}).", config.frameSize,
+                                                                                config.hop + samples);
+        return Result::ERROR;
+    }
+
+    // Frames start every hop. Overlapping frames need the tail of the last input.
+
+    const U64 frames = samples / config.hop;
+    carry = (config.frameSize > config.hop) ? config.frameSize - config.hop : 0;
+
+    if (carry == 0) {
+        history = input.buffer;
+    } else {
+        history = Tensor<D, T>({carry + samples});
+    }
+
+    output.buffer = history;
+    JST_CHECK(output.buffer.as_strided({frames, config.frameSize}, {config.hop, 1}));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Frame<D, T>::info() const {
+    JST_INFO("  Frame Size: {}", config.frameSize);
+    JST_INFO("  Hop:        {}", config.hop);
+    JST_INFO("  View:       {}", (carry == 0) ? "YES" : "NO");
+}
+
+}  // namespace Jetstream
@@ -6,28 +6,46 @@ template<Device D, typename T>
 Result Lineplot<D, T>::createCompute(const RuntimeMetadata&) {
     JST_TRACE("Create Multiply compute core using CPU backend.");
 
+    cpu.sums.assign(numberOfElements, 0.0f);
+    cpu.batches = 0;
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 Result Lineplot<D, T>::compute(const RuntimeMetadata&) {
-    const F32 normalizationFactor = 1.0f / (0.5f * numberOfBatches);
-    std::vector<F32> sums(numberOfElements, 0.0f);
+    F32* sums = cpu.sums.data();
 
     for (U64 b = 0; b < numberOfBatches; ++b) {
         for (U64 i = 0; i < numberOfElements; ++i) {
             sums[i] += input.buffer[i + b * numberOfElements];
         }
     }
+    cpu.batches += numberOfBatches;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Lineplot<D, T>::finalize() {
+    if (cpu.batches == 0) {
+        return Result::SUCCESS;
+    }
+
+    // Average of every batch computed since the last present.
+    const F32 normalizationFactor = 1.0f / (0.5f * cpu.batches);
 
     for (U64 i = 0; i < numberOfElements; ++i) {
-        plot[(i * 3) + 1] = (sums[i] * normalizationFactor) - 1.0f;
+        plot[(i * 3) + 1] = (cpu.sums[i] * normalizationFactor) - 1.0f;
     }
 
+    std::fill(cpu.sums.begin(), cpu.sums.end(), 0.0f);
+    cpu.batches = 0;
+
     return Result::SUCCESS;
 }
 
 JST_LINEPLOT_CPU(JST_INSTANTIATION)
 JST_LINEPLOT_CPU(JST_BENCHMARK)
 
-}  // namespace Jetstream
\ No newline at end of file
+}  // namespace Jetstream
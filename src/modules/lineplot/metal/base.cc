@@ -59,6 +59,12 @@ Result Lineplot<D, T>::compute(const RuntimeMetadata& meta) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Lineplot<D, T>::finalize() {
+    // The compute kernel writes the displayed data directly.
+    return Result::SUCCESS;
+}
+
 JST_LINEPLOT_METAL(JST_INSTANTIATION)
 JST_LINEPLOT_METAL(JST_BENCHMARK)
 
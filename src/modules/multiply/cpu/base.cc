@@ -6,14 +6,81 @@
 
 namespace Jetstream {
 
+// Element-wise product of contiguous tensors. Compiled once for the baseline
+// ISA and once for AVX2 with FMA, the variant is picked from the runtime
+// capabilities of the processor.
+
+template<typename T>
+static inline void MultiplyContiguousKernel(const T* a, const T* b, T* c, const U64& size) {
+    if constexpr (std::is_same_v<T, CF32>) {
+        const F32* x = reinterpret_cast<const F32*>(a);
+        const F32* y = reinterpret_cast<const F32*>(b);
+        F32* z = reinterpret_cast<F32*>(c);
+
+        for (U64 i = 0; i < size * 2; i += 2) {
+            const F32 re = x[i] * y[i] - x[i + 1] * y[i + 1];
+            const F32 im = x[i] * y[i + 1] + x[i + 1] * y[i];
+            z[i] = re;
+            z[i + 1] = im;
+        }
+    } else {
+        for (U64 i = 0; i < size; i++) {
+            c[i] = a[i] * b[i];
+        }
+    }
+}
+
+template<typename T>
+static void MultiplyContiguous(const T* a, const T* b, T* c, const U64& size) {
+    MultiplyContiguousKernel(a, b, c, size);
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define JST_MULTIPLY_AVX2_AVAILABLE
+
+template<typename T>
+__attribute__((target("avx2,fma")))
+static void MultiplyContiguousAVX2(const T* a, const T* b, T* c, const U64& size) {
+    MultiplyContiguousKernel(a, b, c, size);
+}
+#endif
+
 template<Device D, typename T>
 Result Multiply<D, T>::createCompute(const RuntimeMetadata&) {
     JST_TRACE("Create Multiply compute core using CPU backend.");
+
+    // Broadcasted or strided tensors fall back to the automatic iterator.
+
+    cpu.kernel = nullptr;
+
+    if (a.contiguous() && b.contiguous() && c.contiguous() &&
+        a.size() == c.size() && b.size() == c.size()) {
+        cpu.kernel = &MultiplyContiguous<T>;
+
+#ifdef JST_MULTIPLY_AVX2_AVAILABLE
+        const auto& caps = Backend::CPU::GetCapabilities();
+        if (caps.avx2 && caps.fma) {
+            cpu.kernel = &MultiplyContiguousAVX2<T>;
+        }
+#endif
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Multiply compute core using CPU backend.");
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 Result Multiply<D, T>::compute(const RuntimeMetadata&) {
+    if (cpu.kernel) {
+        cpu.kernel(a.data(), b.data(), c.data(), c.size());
+        return Result::SUCCESS;
+    }
+
     Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
         if constexpr (std::is_same_v<T, CF32>) {
             c = std::complex<F32>(a.real() * b.real() - a.imag() * b.imag(),
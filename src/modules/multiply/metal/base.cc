@@ -30,6 +30,12 @@ Result Multiply<D, T>::createCompute(const RuntimeMetadata& meta) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Multiply<D, T>::destroyCompute(const RuntimeMetadata& meta) {
+    JST_TRACE("Destroy Multiply compute core using Metal backend.");
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Multiply<D, T>::compute(const RuntimeMetadata& meta) {
     auto& assets = metal;
@@ -0,0 +1,139 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// Broadcasting is resolved in the kernel with the strides of each factor
+// (zero along broadcasted axes), the product is always contiguous.
+
+static const char shadersSrcCF32[] = R"""(
+    #version 450
+
+    layout(local_size_x = 256) in;
+
+    layout(std430, binding = 0) readonly buffer FactorA { vec2 factorA[]; };
+    layout(std430, binding = 1) readonly buffer FactorB { vec2 factorB[]; };
+    layout(std430, binding = 2) writeonly buffer Product { vec2 product[]; };
+
+    layout(push_constant) uniform Constants {
+        uint size;
+        uint rank;
+        uint offsetA;
+        uint offsetB;
+        uint shape[4];
+        uint strideA[4];
+        uint strideB[4];
+    } constants;
+
+    void main() {
+        const uint id = gl_GlobalInvocationID.x;
+        if (id >= constants.size) {
+            return;
+        }
+
+        uint indexA = constants.offsetA;
+        uint indexB = constants.offsetB;
+        uint remainder = id;
+        for (int i = int(constants.rank) - 1; i >= 0; i--) {
+            const uint coordinate = remainder % constants.shape[i];
+            remainder /= constants.shape[i];
+            indexA += coordinate * constants.strideA[i];
+            indexB += coordinate * constants.strideB[i];
+        }
+
+        const vec2 a = factorA[indexA];
+        const vec2 b = factorB[indexB];
+        product[id] = vec2((a.x * b.x) - (a.y * b.y),
+                           (a.x * b.y) + (a.y * b.x));
+    }
+)""";
+
+static const char shadersSrcF32[] = R"""(
+    #version 450
+
+    layout(local_size_x = 256) in;
+
+    layout(std430, binding = 0) readonly buffer FactorA { float factorA[]; };
+    layout(std430, binding = 1) readonly buffer FactorB { float factorB[]; };
+    layout(std430, binding = 2) writeonly buffer Product { float product[]; };
+
+    layout(push_constant) uniform Constants {
+        uint size;
+        uint rank;
+        uint offsetA;
+        uint offsetB;
+        uint shape[4];
+        uint strideA[4];
+        uint strideB[4];
+    } constants;
+
+    void main() {
+        const uint id = gl_GlobalInvocationID.x;
+        if (id >= constants.size) {
+            return;
+        }
+
+        uint indexA = constants.offsetA;
+        uint indexB = constants.offsetB;
+        uint remainder = id;
+        for (int i = int(constants.rank) - 1; i >= 0; i--) {
+            const uint coordinate = remainder % constants.shape[i];
+            remainder /= constants.shape[i];
+            indexA += coordinate * constants.strideA[i];
+            indexB += coordinate * constants.strideB[i];
+        }
+
+        product[id] = factorA[indexA] * factorB[indexB];
+    }
+)""";
+
+template<Device D, typename T>
+Result Multiply<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create Multiply compute core using Vulkan backend.");
+
+    auto& assets = vulkan;
+
+    if (c.rank() > 4) {
+        JST_ERROR("[MULTIPLY] Vulkan backend supports tensors up to rank 4.");
+        return Result::ERROR;
+    }
+
+    assets.constants = {};
+    assets.constants.size = c.size();
+    assets.constants.rank = c.rank();
+    assets.constants.offsetA = a.offset();
+    assets.constants.offsetB = b.offset();
+    for (U64 i = 0; i < c.rank(); i++) {
+        assets.constants.shape[i] = c.shape()[i];
+        assets.constants.strideA[i] = a.stride()[i];
+        assets.constants.strideB[i] = b.stride()[i];
+    }
+
+    const char* shadersSrc = (std::is_same_v<T, CF32>) ? shadersSrcCF32 : shadersSrcF32;
+    JST_CHECK(Vulkan::CompileKernel(shadersSrc, 3, sizeof(VulkanConstants), assets.kernel));
+    JST_CHECK(Vulkan::BindBuffers(assets.kernel, {a.data(), b.data(), c.data()}));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Multiply compute core using Vulkan backend.");
+
+    JST_CHECK(Vulkan::DestroyKernel(vulkan.kernel));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::compute(const RuntimeMetadata& meta) {
+    auto& assets = vulkan;
+
+    JST_CHECK(Vulkan::Dispatch(meta, assets.kernel, assets.constants, c.size()));
+
+    return Result::SUCCESS;
+}
+
+JST_MULTIPLY_VULKAN(JST_INSTANTIATION)
+JST_MULTIPLY_VULKAN(JST_BENCHMARK)
+
+}  // namespace Jetstream
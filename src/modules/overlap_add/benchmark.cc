@@ -0,0 +1,117 @@
+#include "jetstream/modules/overlap_add.hh"
+#include "jetstream/modules/pad.hh"
+#include "jetstream/modules/fft.hh"
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/unpad.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8256 Overlap 8x256", {
+        .axis = 1 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8256}) COMMA
+        .overlap = Tensor<D COMMA T>({8 COMMA 256}) COMMA
+    }, T);
+
+#if defined(JETSTREAM_MODULE_PAD_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_FFT_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE) && \
+    defined(JETSTREAM_MODULE_UNPAD_CPU_AVAILABLE) && \
+    defined(JETSTREAM_BACKEND_CPU_AVAILABLE)
+
+    // Filter Engine chain (pad, FFT, multiply, IFFT, unpad, overlap-add) with
+    // every buffer on the node of the computing thread, then on another node.
+    // On single node machines only the local placement runs.
+
+    if constexpr (D == Device::CPU && std::is_same_v<T, CF32>) {
+        const U64 nodes = Backend::CPU::GetNumaNodeCount();
+        Backend::CPU::BindThreadToNumaNode((nodes > 1) ? 0 : -1);
+
+        const auto run = [&](const std::string& placement, const I64& node) {
+            Backend::CPU::NumaScope scope(node);
+
+            const U64 signalSize = 8000;
+            const U64 filterSize = 257;
+
+            Tensor<D, T> signal({8, signalSize});
+            Tensor<D, T> filter({1, filterSize});
+
+            auto padSignal = std::make_shared<Pad<D, T>>();
+            padSignal->init_benchmark_mode({ .size = filterSize - 1, .axis = 1 }, { .unpadded = signal });
+            padSignal->create();
+
+            auto padFilter = std::make_shared<Pad<D, T>>();
+            padFilter->init_benchmark_mode({ .size = signalSize - 1, .axis = 1 }, { .unpadded = filter });
+            padFilter->create();
+
+            auto fftSignal = std::make_shared<FFT<D, T>>();
+            fftSignal->init_benchmark_mode({ .forward = true }, { .buffer = padSignal->getOutputPadded() });
+            fftSignal->create();
+
+            auto fftFilter = std::make_shared<FFT<D, T>>();
+            fftFilter->init_benchmark_mode({ .forward = true }, { .buffer = padFilter->getOutputPadded() });
+            fftFilter->create();
+
+            auto multiply = std::make_shared<Multiply<D, T>>();
+            multiply->init_benchmark_mode({}, { .factorA = fftSignal->getOutputBuffer(),
+                                                .factorB = fftFilter->getOutputBuffer() });
+            multiply->create();
+
+            auto ifft = std::make_shared<FFT<D, T>>();
+            ifft->init_benchmark_mode({ .forward = false }, { .buffer = multiply->getOutputProduct() });
+            ifft->create();
+
+            auto unpad = std::make_shared<Unpad<D, T>>();
+            unpad->init_benchmark_mode({ .size = filterSize - 1, .axis = 1 }, { .padded = ifft->getOutputBuffer() });
+            unpad->create();
+
+            auto overlap = std::make_shared<Module<D, T>>();
+            overlap->init_benchmark_mode({ .axis = 1 }, { .buffer = unpad->getOutputUnpadded(),
+                                                          .overlap = unpad->getOutputPad() });
+            overlap->create();
+
+            auto graph = NewGraph(D);
+            graph->setModule(padSignal);
+            graph->setModule(padFilter);
+            graph->setModule(fftSignal);
+            graph->setModule(fftFilter);
+            graph->setModule(multiply);
+            graph->setModule(ifft);
+            graph->setModule(unpad);
+            graph->setModule(overlap);
+            graph->create();
+
+            const auto entry = name + "8x8000 Filter Engine " + placement;
+
+            U64 calls = 0;
+            Benchmark::CountersBegin();
+            bench.run(entry, [&] {
+                graph->compute();
+                calls++;
+            });
+            Benchmark::CountersEnd(entry, calls);
+
+            const U64 bytes = padSignal->benchmark_bytes() + padFilter->benchmark_bytes() +
+                              fftSignal->benchmark_bytes() + fftFilter->benchmark_bytes() +
+                              multiply->benchmark_bytes() + ifft->benchmark_bytes() +
+                              unpad->benchmark_bytes() + overlap->benchmark_bytes();
+            const F64 flops = fftSignal->benchmark_flops() + fftFilter->benchmark_flops() +
+                              multiply->benchmark_flops() + ifft->benchmark_flops();
+            Benchmark::SetWorkload(entry, bytes, flops);
+
+            graph->destroy();
+        };
+
+        run("Local Node", (nodes > 1) ? 0 : -1);
+
+        if (nodes > 1) {
+            run("Remote Node", nodes - 1);
+        }
+    }
+
+#endif
+}
+
+}  // namespace Jetstream
@@ -49,5 +49,6 @@ Result OverlapAdd<D, T>::compute(const RuntimeMetadata&) {
 }
 
 JST_OVERLAP_ADD_CPU(JST_INSTANTIATION)
+JST_OVERLAP_ADD_CPU(JST_BENCHMARK)
     
 }  // namespace Jetstream
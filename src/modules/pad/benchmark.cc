@@ -0,0 +1,15 @@
+#include "jetstream/modules/pad.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("128x8000 Axis 1", {
+        .size = 192 COMMA
+        .axis = 1 COMMA
+    }, {
+        .unpadded = Tensor<D COMMA T>({128 COMMA 8000}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
\ No newline at end of file
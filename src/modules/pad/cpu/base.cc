@@ -24,5 +24,6 @@ Result Pad<D, T>::compute(const RuntimeMetadata&) {
 }
 
 JST_PAD_CPU(JST_INSTANTIATION)
+JST_PAD_CPU(JST_BENCHMARK)
     
 }  // namespace Jetstream
@@ -14,10 +14,18 @@ Result Scale<D, T>::createCompute(const RuntimeMetadata&) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Scale<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Scale compute core using CPU backend.");
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Scale<D, T>::compute(const RuntimeMetadata&) {
     auto [min, max] = config.range;
 
+    JST_CHECK(output.buffer.make_writable());
+
     for (U64 i = 0; i < input.buffer.size(); i++) {
         output.buffer[i] = scale<T>(input.buffer[i], min, max);
     }
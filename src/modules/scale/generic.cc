@@ -7,9 +7,21 @@ Result Scale<D, T>::create() {
     JST_DEBUG("Initializing Scale module.");
     JST_INIT_IO();
 
-    // Allocate output.
+    // Check parameters.
 
-    output.buffer = Tensor<D, T>(input.buffer.shape());
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
+    // Allocate output. The CPU kernel scales in-place unless the input
+    // also feeds other branches.
+
+    if constexpr (D == Device::CPU) {
+        JST_CHECK(input.buffer.copy_on_write(output.buffer));
+    } else {
+        output.buffer = Tensor<D, T>(input.buffer.shape());
+    }
 
     return Result::SUCCESS;
 }
@@ -34,6 +34,12 @@ Result Scale<D, T>::createCompute(const RuntimeMetadata& meta) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Scale<D, T>::destroyCompute(const RuntimeMetadata& meta) {
+    JST_TRACE("Destroy Scale compute core using Metal backend.");
+    return Result::SUCCESS;
+}
+
 template<Device D, typename T>
 Result Scale<D, T>::compute(const RuntimeMetadata& meta) {
     auto& assets = metal;
@@ -0,0 +1,75 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+static const char shadersSrc[] = R"""(
+    #version 450
+
+    layout(local_size_x = 256) in;
+
+    layout(std430, binding = 0) readonly buffer Input { float inputBuffer[]; };
+    layout(std430, binding = 1) writeonly buffer Output { float outputBuffer[]; };
+
+    layout(push_constant) uniform Constants {
+        uint size;
+        uint offset;
+        float min;
+        float max;
+    } constants;
+
+    void main() {
+        const uint id = gl_GlobalInvocationID.x;
+        if (id >= constants.size) {
+            return;
+        }
+
+        outputBuffer[id] = (inputBuffer[constants.offset + id] - constants.min) / (constants.max - constants.min);
+    }
+)""";
+
+template<Device D, typename T>
+Result Scale<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create Scale compute core using Vulkan backend.");
+
+    auto& assets = vulkan;
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("[SCALE] Vulkan backend requires a contiguous input.");
+        return Result::ERROR;
+    }
+
+    JST_CHECK(Vulkan::CompileKernel(shadersSrc, 2, sizeof(VulkanConstants), assets.kernel));
+    JST_CHECK(Vulkan::BindBuffers(assets.kernel, {input.buffer.data(), output.buffer.data()}));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Scale compute core using Vulkan backend.");
+
+    JST_CHECK(Vulkan::DestroyKernel(vulkan.kernel));
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::compute(const RuntimeMetadata& meta) {
+    auto& assets = vulkan;
+
+    // The range can change between computes, it travels as push constants.
+
+    VulkanConstants constants = {};
+    constants.size = output.buffer.size();
+    constants.offset = input.buffer.offset();
+    constants.min = config.range.min;
+    constants.max = config.range.max;
+
+    JST_CHECK(Vulkan::Dispatch(meta, assets.kernel, constants, output.buffer.size()));
+
+    return Result::SUCCESS;
+}
+
+JST_SCALE_VULKAN(JST_INSTANTIATION)
+
+}  // namespace Jetstream
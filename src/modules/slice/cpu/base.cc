@@ -0,0 +1,22 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Slice<D, T>::compute(const RuntimeMetadata&) {
+    if (aliased) {
+        return Result::SUCCESS;
+    }
+
+    Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+        out = in;
+    }, view, output.buffer);
+
+    return Result::SUCCESS;
+}
+
+JST_SLICE_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
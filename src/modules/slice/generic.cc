@@ -0,0 +1,140 @@
+#include <cctype>
+#include <sstream>
+#include <algorithm>
+
+#include "jetstream/modules/slice.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Slice<D, T>::ParseTokens(const std::string& slice, std::vector<Token>& tokens) {
+    tokens.clear();
+
+    std::string body = slice;
+    body.erase(std::remove_if(body.begin(), body.end(), ::isspace), body.end());
+
+    if (body.size() < 2 || body.front() != '[' || body.back() != ']') {
+        JST_ERROR("Slice '{}' should be enclosed in brackets.", slice);
+        return Result::ERROR;
+    }
+    body = body.substr(1, body.size() - 2);
+
+    const auto parseNumber = [&](const std::string& text, U64& value) {
+        if (text.empty() || !std::all_of(text.begin(), text.end(), ::isdigit)) {
+            JST_ERROR("Invalid index '{}' in slice '{}'.", text, slice);
+            return Result::ERROR;
+        }
+        value = std::stoull(text);
+        return Result::SUCCESS;
+    };
+
+    std::stringstream stream(body);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (item == "...") {
+            tokens.push_back("...");
+            continue;
+        }
+
+        if (item.find(':') == std::string::npos) {
+            U64 index = 0;
+            JST_CHECK(parseNumber(item, index));
+            tokens.push_back(index);
+            continue;
+        }
+
+        // Start, end and step. Empty fields keep their defaults.
+        std::vector<std::string> fields;
+        std::stringstream itemStream(item);
+        std::string field;
+        while (std::getline(itemStream, field, ':')) {
+            fields.push_back(field);
+        }
+        if (item.back() == ':') {
+            fields.push_back("");
+        }
+
+        if (fields.size() > 3) {
+            JST_ERROR("Invalid range '{}' in slice '{}'.", item, slice);
+            return Result::ERROR;
+        }
+
+        U64 values[3] = {0, 0, 1};
+        for (U64 i = 0; i < fields.size(); i++) {
+            if (!fields[i].empty()) {
+                JST_CHECK(parseNumber(fields[i], values[i]));
+            }
+        }
+
+        if (values[2] == 0) {
+            JST_ERROR("Slice step can't be zero in '{}'.", slice);
+            return Result::ERROR;
+        }
+
+        tokens.push_back({values[0], values[1], values[2]});
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Slice<D, T>::create() {
+    JST_DEBUG("Initializing Slice module.");
+    JST_INIT_IO();
+
+    // Parse slice.
+
+    std::vector<Token> tokens;
+    JST_CHECK(ParseTokens(config.slice, tokens));
+
+    // Check parameters.
+
+    U64 dim = 0;
+    for (const auto& token : tokens) {
+        if (token.get_type() == Token::Type::Ellipsis) {
+            dim = input.buffer.rank() - (tokens.size() - 1 - dim);
+            continue;
+        }
+
+        if (dim >= input.buffer.rank()) {
+            JST_ERROR("Slice '{}' has more dimensions than the input ({}).", config.slice,
+                                                                             input.buffer.rank());
+            return Result::ERROR;
+        }
+
+        const U64 size = input.buffer.shape(dim);
+        const U64 end = (token.get_b() == 0) ? size : token.get_b();
+
+        if (token.get_a() >= size || end > size || token.get_a() >= end) {
+            JST_ERROR("Slice '{}' is out of bounds for axis {} with size {}.", config.slice, dim, size);
+            return Result::ERROR;
+        }
+
+        dim++;
+    }
+
+    // Create view of the input.
+
+    view = input.buffer;
+    JST_CHECK(view.view(tokens));
+
+    // Dense views are published as is. The others are gathered every frame.
+
+    if (view.contiguous()) {
+        output.buffer = view;
+        aliased = true;
+    } else {
+        output.buffer = Tensor<D, T>(view.shape());
+        aliased = false;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Slice<D, T>::info() const {
+    JST_INFO("  Slice: {}", config.slice);
+    JST_INFO("  View:  {}", aliased ? "YES" : "NO");
+}
+
+}  // namespace Jetstream
@@ -93,10 +93,15 @@ Result Soapy<D, T>::create() {
     // Allocate circular buffer.
 
     buffer.resize(output.buffer.size() * config.bufferMultiplier);
+    buffer.publishMetrics(locale().shash());
 
     // Initialize thread for ingest.
 
     producer = std::thread([&]{
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        Backend::State<Device::CPU>()->applyThreadPolicy(Backend::CPU::ThreadRole::Source);
+#endif
+
         try {
             JST_CHECK_THROW(soapyThreadLoop());
         } catch(...) {
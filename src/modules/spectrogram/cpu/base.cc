@@ -8,26 +8,65 @@ Result Spectrogram<D, T>::createCompute(const RuntimeMetadata&) {
 
     decayFactor = pow(0.999, numberOfBatches);
 
+    cpu.hits.assign(frequencyBins.size(), 0.0f);
+    cpu.frames = 0;
+    cpu.weight = 1.0f;
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 Result Spectrogram<D, T>::compute(const RuntimeMetadata&) {
-    const U64& size = frequencyBins.size();
-    const F32 factor = decayFactor;
-    for (U64 x = 0; x < size; ++x) {
-        frequencyBins[x] *= factor;
-    }
+    F32* hits = cpu.hits.data();
+
+    // Frame k is weighted by decayFactor^-k so every frame keeps the decay
+    // it would have had if the bins were decayed once per frame.
+    const F32 hit = 0.02f * cpu.weight;
 
     for (U64 b = 0; b < numberOfBatches; b++) {
         for (U64 x = 0; x < numberOfElements; x++) {
             const U16 index = input.buffer[{b, x}] * config.height;
 
             if (index < config.height && index > 0) {
-                frequencyBins[x + (index * numberOfElements)] += 0.02; 
+                hits[x + (index * numberOfElements)] += hit; 
             }
         }
     }
+    cpu.frames += 1;
+    cpu.weight /= decayFactor;
+
+    // Fold the weight into the hits before it grows out of range.
+    if (cpu.weight > 1.0e6f) {
+        const U64& size = cpu.hits.size();
+        const F32 scale = 1.0f / cpu.weight;
+        for (U64 x = 0; x < size; ++x) {
+            hits[x] *= scale;
+        }
+        cpu.weight = 1.0f;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Spectrogram<D, T>::finalize() {
+    if (cpu.frames == 0) {
+        return Result::SUCCESS;
+    }
+
+    // The decay of every frame since the last present is applied at once.
+    // The weighted hits are brought back to the scale of the last frame.
+    const U64& size = frequencyBins.size();
+    const F32 factor = pow(decayFactor, cpu.frames);
+    const F32 scale = 1.0f / (cpu.weight * decayFactor);
+    F32* hits = cpu.hits.data();
+
+    for (U64 x = 0; x < size; ++x) {
+        frequencyBins[x] = (frequencyBins[x] * factor) + (hits[x] * scale);
+        hits[x] = 0.0f;
+    }
+    cpu.frames = 0;
+    cpu.weight = 1.0f;
 
     return Result::SUCCESS;
 }
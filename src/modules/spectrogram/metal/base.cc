@@ -96,6 +96,12 @@ Result Spectrogram<D, T>::compute(const RuntimeMetadata& meta) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Spectrogram<D, T>::finalize() {
+    // The compute kernel writes the displayed data directly.
+    return Result::SUCCESS;
+}
+
 JST_SPECTROGRAM_METAL(JST_INSTANTIATION)
 
 }  // namespace Jetstream
@@ -21,21 +21,36 @@ Result Take<D, T>::create() {
         return Result::ERROR;
     }
 
-    // Calculate output shape.
+    // Publish a view of the input when the slice is dense.
+
+    std::vector<Token> tokens(input.buffer.rank());
+    tokens[config.axis] = Token(config.index, config.index + 1);
+
+    auto view = input.buffer;
+    JST_CHECK(view.view(tokens));
+
+    if (view.contiguous()) {
+        output.buffer = view;
+        aliased = true;
+        return Result::SUCCESS;
+    }
+
+    // Otherwise, allocate output and copy the slice every frame.
 
     std::vector<U64> outputShape = input.buffer.shape();
     outputShape[config.axis] = 1;
 
-    // Allocate output.
-
     output.buffer = Tensor<D, T>(outputShape);
+    aliased = false;
 
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
 void Take<D, T>::info() const {
-    JST_INFO("  None");
+    JST_INFO("  Index: {}", config.index);
+    JST_INFO("  Axis:  {}", config.axis);
+    JST_INFO("  View:  {}", aliased ? "YES" : "NO");
 }
 
 }  // namespace Jetstream
@@ -0,0 +1,24 @@
+#include "jetstream/modules/tone_bank.hh"
+
+namespace Jetstream {
+
+template<template<Device, typename...> class Module, Device D, typename T>
+void benchmark(ankerl::nanobench::Bench& bench, std::string name) {
+    JST_BENCHMARK_RUN("8x8192 4 Bins", {
+        .frequencies = {-250.0e3f COMMA -50.0e3f COMMA 50.0e3f COMMA 250.0e3f} COMMA
+        .window = 8192 COMMA
+        .hop = 256 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+
+    JST_BENCHMARK_RUN("8x8192 32 Bins", {
+        .frequencies = std::vector<F32>(32 COMMA 100.0e3f) COMMA
+        .window = 8192 COMMA
+        .hop = 256 COMMA
+    }, {
+        .buffer = Tensor<D COMMA T>({8 COMMA 8192}) COMMA
+    }, T);
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,111 @@
+#include "../generic.cc"
+
+namespace Jetstream {
+
+// The recursion is marginally stable. A slight damping keeps the rounding
+// errors from accumulating over long runs.
+
+static constexpr F64 ToneBankDamping = 1.0 - 1.0e-6;
+
+template<Device D, typename T>
+Result ToneBank<D, T>::createCompute(const RuntimeMetadata&) {
+    JST_TRACE("Create Tone Bank compute core using CPU backend.");
+
+    const U64 bins = config.frequencies.size();
+
+    // X[n] = w · X[n - 1] + x[n] - w^N · x[n - N] with w = r · e^(jω). The
+    // power is taken from the rounded twiddle so the oldest sample cancels.
+
+    for (const auto& frequency : config.frequencies) {
+        const F64 omega = 2.0 * JST_PI * frequency / config.sampleRate;
+
+        cpu.twiddleReal.push_back(ToneBankDamping * std::cos(omega));
+        cpu.twiddleImag.push_back(ToneBankDamping * std::sin(omega));
+
+        const std::complex<F64> twiddle(cpu.twiddleReal.back(), cpu.twiddleImag.back());
+        const auto windowTwiddle = std::pow(twiddle, static_cast<F64>(config.window));
+
+        cpu.windowTwiddleReal.push_back(windowTwiddle.real());
+        cpu.windowTwiddleImag.push_back(windowTwiddle.imag());
+    }
+
+    cpu.stateReal.assign(numberOfChannels * bins, 0.0f);
+    cpu.stateImag.assign(numberOfChannels * bins, 0.0f);
+    cpu.history.assign(numberOfChannels * config.window, CF32(0.0f, 0.0f));
+    cpu.cursor = 0;
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result ToneBank<D, T>::destroyCompute(const RuntimeMetadata&) {
+    JST_TRACE("Destroy Tone Bank compute core using CPU backend.");
+
+    cpu.twiddleReal.clear();
+    cpu.twiddleImag.clear();
+    cpu.windowTwiddleReal.clear();
+    cpu.windowTwiddleImag.clear();
+    cpu.stateReal.clear();
+    cpu.stateImag.clear();
+    cpu.history.clear();
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result ToneBank<D, T>::compute(const RuntimeMetadata&) {
+    const U64 bins = config.frequencies.size();
+    const U64 window = config.window;
+    const U64 outputs = numberOfSamples / config.hop;
+
+    const F32* wr = cpu.twiddleReal.data();
+    const F32* wi = cpu.twiddleImag.data();
+    const F32* nr = cpu.windowTwiddleReal.data();
+    const F32* ni = cpu.windowTwiddleImag.data();
+
+    U64 cursor = cpu.cursor;
+
+    for (U64 c = 0; c < numberOfChannels; c++) {
+        const CF32* in = input.buffer.data() + c * numberOfSamples;
+        CF32* out = output.buffer.data() + c * bins * outputs;
+        CF32* history = cpu.history.data() + c * window;
+        F32* xr = cpu.stateReal.data() + c * bins;
+        F32* xi = cpu.stateImag.data() + c * bins;
+
+        cursor = cpu.cursor;
+
+        for (U64 n = 0; n < numberOfSamples; n++) {
+            const CF32 sample = in[n];
+            const CF32 oldest = history[cursor];
+            history[cursor] = sample;
+            cursor = (cursor + 1 == window) ? 0 : cursor + 1;
+
+            // Bins are independent. The loop over them vectorizes.
+
+            for (U64 k = 0; k < bins; k++) {
+                const F32 real = wr[k] * xr[k] - wi[k] * xi[k] + sample.real() -
+                                 (nr[k] * oldest.real() - ni[k] * oldest.imag());
+                const F32 imag = wr[k] * xi[k] + wi[k] * xr[k] + sample.imag() -
+                                 (nr[k] * oldest.imag() + ni[k] * oldest.real());
+                xr[k] = real;
+                xi[k] = imag;
+            }
+
+            if ((n + 1) % config.hop == 0) {
+                const U64 t = n / config.hop;
+                for (U64 k = 0; k < bins; k++) {
+                    out[k * outputs + t] = CF32(xr[k], xi[k]);
+                }
+            }
+        }
+    }
+
+    cpu.cursor = cursor;
+
+    return Result::SUCCESS;
+}
+
+JST_TONE_BANK_CPU(JST_INSTANTIATION)
+JST_TONE_BANK_CPU(JST_BENCHMARK)
+
+}  // namespace Jetstream
@@ -0,0 +1,72 @@
+#include <cmath>
+
+#include "jetstream/modules/tone_bank.hh"
+
+#include "benchmark.cc"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result ToneBank<D, T>::create() {
+    JST_DEBUG("Initializing Tone Bank module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    if (input.buffer.rank() == 0 || input.buffer.rank() > 2) {
+        JST_ERROR("Input should be {{samples}} or {{batch, samples}}, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (input.buffer.size() == 0) {
+        JST_ERROR("Input should not be empty, got {}.", input.buffer.shape());
+        return Result::ERROR;
+    }
+
+    if (!input.buffer.contiguous()) {
+        JST_ERROR("Input should be contiguous.");
+        return Result::ERROR;
+    }
+
+    if (config.frequencies.empty()) {
+        JST_ERROR("At least one frequency is required.");
+        return Result::ERROR;
+    }
+
+    for (const auto& frequency : config.frequencies) {
+        if (std::abs(frequency) > config.sampleRate / 2.0f) {
+            JST_ERROR("Frequency ({:.3f} MHz) is outside the sample rate ({:.3f} MHz).", frequency / JST_MHZ,
+                                                                                         config.sampleRate / JST_MHZ);
+            return Result::ERROR;
+        }
+    }
+
+    numberOfSamples = input.buffer.shape()[input.buffer.rank() - 1];
+    numberOfChannels = input.buffer.size() / numberOfSamples;
+
+    if (config.window == 0 || config.hop == 0 || numberOfSamples % config.hop != 0) {
+        JST_ERROR("Window ({}) and hop ({}) should be larger than zero and the hop should divide "
+                  "the number of samples ({}).", config.window, config.hop, numberOfSamples);
+        return Result::ERROR;
+    }
+
+    // Allocate output.
+
+    std::vector<U64> shape = {config.frequencies.size(), numberOfSamples / config.hop};
+    if (input.buffer.rank() == 2) {
+        shape.insert(shape.begin(), numberOfChannels);
+    }
+    output.buffer = Tensor<D, T>(shape);
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void ToneBank<D, T>::info() const {
+    JST_INFO("  Frequencies: {} Hz", config.frequencies);
+    JST_INFO("  Sample Rate: {:.2f} MHz", config.sampleRate / JST_MHZ);
+    JST_INFO("  Window:      {}", config.window);
+    JST_INFO("  Hop:         {}", config.hop);
+}
+
+}  // namespace Jetstream
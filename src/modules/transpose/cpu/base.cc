@@ -0,0 +1,78 @@
+#include "../generic.cc"
+
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream {
+
+static constexpr U64 TransposeParallelBytes = 1 << 20;
+
+template<Device D, typename T>
+Result Transpose<D, T>::compute(const RuntimeMetadata&) {
+    if (aliased) {
+        return Result::SUCCESS;
+    }
+
+    if (!blocked) {
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in;
+        }, view, output.buffer);
+
+        return Result::SUCCESS;
+    }
+
+    const auto& shape = view.shape();
+    const auto& inStride = view.stride();
+    const auto& outStride = output.buffer.stride();
+    const U64 last = view.rank() - 1;
+
+    const U64 rows = shape[last];
+    const U64 cols = shape[fastAxis];
+    const U64 count = view.size() / (rows * cols);
+
+    const T* in = view.data();
+    T* out = output.buffer.data();
+
+    // Every other axis picks one of the rows x cols transposes.
+
+    const auto transpose = [&](const U64& b) {
+        U64 rest = b;
+        U64 inOffset = 0;
+        U64 outOffset = 0;
+
+        for (I64 d = last - 1; d >= 0; d--) {
+            if (static_cast<U64>(d) == fastAxis) {
+                continue;
+            }
+
+            const U64 coord = rest % shape[d];
+            rest /= shape[d];
+
+            inOffset += coord * inStride[d];
+            outOffset += coord * outStride[d];
+        }
+
+        Memory::CPU::BlockedTranspose(in + inOffset,
+                                      out + outOffset,
+                                      rows,
+                                      cols,
+                                      inStride[last],
+                                      outStride[fastAxis]);
+    };
+
+    // The transposes are independent. Large ones are spread across the
+    // worker pool, small ones aren't worth the wake-ups.
+
+    if (count > 1 && view.size_bytes() >= TransposeParallelBytes) {
+        return Backend::State<Device::CPU>()->parallelFor(count, transpose);
+    }
+
+    for (U64 b = 0; b < count; b++) {
+        transpose(b);
+    }
+
+    return Result::SUCCESS;
+}
+
+JST_TRANSPOSE_CPU(JST_INSTANTIATION)
+
+}  // namespace Jetstream
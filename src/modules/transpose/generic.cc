@@ -0,0 +1,88 @@
+#include <cctype>
+#include <sstream>
+#include <algorithm>
+
+#include "jetstream/modules/transpose.hh"
+
+namespace Jetstream {
+
+template<Device D, typename T>
+Result Transpose<D, T>::ParseAxes(const std::string& text, std::vector<U64>& axes) {
+    axes.clear();
+
+    std::string body = text;
+    body.erase(std::remove_if(body.begin(), body.end(), ::isspace), body.end());
+
+    if (body.size() < 2 || body.front() != '[' || body.back() != ']') {
+        JST_ERROR("Axes '{}' should be enclosed in brackets.", text);
+        return Result::ERROR;
+    }
+    body = body.substr(1, body.size() - 2);
+
+    std::stringstream stream(body);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (item.empty() || !std::all_of(item.begin(), item.end(), ::isdigit)) {
+            JST_ERROR("Invalid axis '{}' in '{}'.", item, text);
+            return Result::ERROR;
+        }
+        axes.push_back(std::stoull(item));
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+Result Transpose<D, T>::create() {
+    JST_DEBUG("Initializing Transpose module.");
+    JST_INIT_IO();
+
+    // Check parameters.
+
+    const U64 rank = input.buffer.rank();
+
+    std::vector<U64> axes = config.axes;
+    if (axes.empty()) {
+        for (U64 i = 0; i < rank; i++) {
+            axes.push_back(rank - 1 - i);
+        }
+    }
+
+    // Create permuted view of the input.
+
+    view = input.buffer;
+    JST_CHECK(view.permute(axes));
+
+    // Dense views are published as is. The others are copied every frame.
+
+    if (view.contiguous()) {
+        output.buffer = view;
+        aliased = true;
+        return Result::SUCCESS;
+    }
+
+    output.buffer = Tensor<D, T>(view.shape());
+    aliased = false;
+
+    // A dense input has an axis with unit stride. If it doesn't end up last,
+    // every frame is a batch of 2D transposes between that axis and the last.
+
+    blocked = false;
+
+    if (input.buffer.contiguous()) {
+        const auto& stride = view.stride();
+        fastAxis = std::find(stride.begin(), stride.end(), 1) - stride.begin();
+        blocked = fastAxis < rank - 1;
+    }
+
+    return Result::SUCCESS;
+}
+
+template<Device D, typename T>
+void Transpose<D, T>::info() const {
+    JST_INFO("  Axes:    {}", config.axes);
+    JST_INFO("  View:    {}", aliased ? "YES" : "NO");
+    JST_INFO("  Blocked: {}", blocked ? "YES" : "NO");
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,165 @@
+#include "jetstream/perf_counters.hh"
+
+#ifdef JST_OS_LINUX
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+namespace Jetstream {
+
+PerfCounters::PerfCounters() {
+    fds.fill(-1);
+    indices.fill(-1);
+    snapshot.fill(0);
+}
+
+PerfCounters::~PerfCounters() {
+    close();
+}
+
+#ifdef JST_OS_LINUX
+
+Result PerfCounters::open() {
+    if (available()) {
+        return Result::SUCCESS;
+    }
+
+    const std::array<U64, EventCount> events = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+
+    for (U64 i = 0; i < EventCount; i++) {
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(perf_event_attr);
+        attr.config = events[i];
+        attr.disabled = (groupFd < 0) ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP |
+                           PERF_FORMAT_TOTAL_TIME_ENABLED |
+                           PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const I32 fd = static_cast<I32>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+
+        if (fd < 0) {
+            // The group leader (cycles) is mandatory. Other events are optional
+            // because some virtualized PMUs don't expose them.
+            if (groupFd < 0) {
+                JST_DEBUG("[PERF] Hardware performance counters unavailable ({}). "
+                          "Check /proc/sys/kernel/perf_event_paranoid.", strerror(errno));
+                return Result::ERROR;
+            }
+            JST_DEBUG("[PERF] Event {} unavailable ({}).", i, strerror(errno));
+            continue;
+        }
+
+        if (groupFd < 0) {
+            groupFd = fd;
+        }
+
+        fds[i] = fd;
+        indices[i] = static_cast<I32>(openedCount++);
+    }
+
+    ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    JST_TRACE("[PERF] Opened {} hardware counters.", openedCount);
+
+    return Result::SUCCESS;
+}
+
+void PerfCounters::close() {
+    for (auto& fd : fds) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        fd = -1;
+    }
+    indices.fill(-1);
+    groupFd = -1;
+    openedCount = 0;
+}
+
+bool PerfCounters::read(std::array<U64, EventCount>& values, U64& enabled, U64& running) const {
+    // Layout: count, time enabled, time running and one value per event.
+    std::array<U64, EventCount + 3> buffer;
+
+    const auto size = sizeof(U64) * (openedCount + 3);
+    if (::read(groupFd, buffer.data(), size) != static_cast<ssize_t>(size)) {
+        return false;
+    }
+
+    enabled = buffer[1];
+    running = buffer[2];
+
+    for (U64 i = 0; i < EventCount; i++) {
+        values[i] = (indices[i] >= 0) ? buffer[indices[i] + 3] : 0;
+    }
+
+    return true;
+}
+
+#else
+
+Result PerfCounters::open() {
+    JST_DEBUG("[PERF] Hardware performance counters are not supported in this platform.");
+    return Result::ERROR;
+}
+
+void PerfCounters::close() {
+}
+
+bool PerfCounters::read(std::array<U64, EventCount>&, U64&, U64&) const {
+    return false;
+}
+
+#endif
+
+void PerfCounters::begin() {
+    if (!available() || !read(snapshot, snapshotEnabled, snapshotRunning)) {
+        snapshot.fill(0);
+        snapshotEnabled = 0;
+        snapshotRunning = 0;
+    }
+}
+
+PerfCounters::Sample PerfCounters::end() {
+    std::array<U64, EventCount> current;
+    U64 enabled, running;
+
+    if (!available() || !read(current, enabled, running)) {
+        return {};
+    }
+
+    // The group only counted while it was on the PMU. Extrapolate to the
+    // whole window. A group that never ran has nothing to report.
+    const U64 windowEnabled = enabled - snapshotEnabled;
+    const U64 windowRunning = running - snapshotRunning;
+
+    if (windowRunning == 0) {
+        return {};
+    }
+
+    const F64 scale = static_cast<F64>(windowEnabled) / windowRunning;
+    const auto delta = [&](const U64& i) {
+        return static_cast<U64>(static_cast<F64>(current[i] - snapshot[i]) * scale);
+    };
+
+    return {
+        .cycles = delta(0),
+        .instructions = delta(1),
+        .cacheMisses = delta(2),
+        .branchMisses = delta(3),
+    };
+}
+
+}  // namespace Jetstream
@@ -11,9 +11,46 @@ Result Window::create() {
 
     graphicalLoopThreadStarted = false;
 
+    lastDraw = {};
+    lastActivity = {};
+
     return Result::SUCCESS;
 }
 
+bool Window::shouldDraw(const bool& dirty) {
+    if (!config.renderOnDemand) {
+        return true;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // A resize must reach begin() so the swapchain gets recreated.
+    bool activity = dirty ||
+                    resizePending() ||
+                    !surfaceBindQueue.empty() ||
+                    !surfaceUnbindQueue.empty();
+
+    if (config.imgui && ImGui::GetCurrentContext()) {
+        activity |= ImGui::GetCurrentContext()->InputEventsQueue.Size > 0;
+    }
+
+    if (activity) {
+        lastActivity = now;
+    }
+
+    // Keep drawing for a while after any activity. This lets the interface
+    // settle (hover states, tooltip delays, scrolling) before going idle.
+    const auto settle = std::chrono::milliseconds(500);
+    const auto idlePeriod = std::chrono::duration<F32>(1.0f / std::max(config.idleFramerate, 0.01f));
+
+    if ((now - lastActivity) < settle || (now - lastDraw) >= idlePeriod) {
+        lastDraw = now;
+        return true;
+    }
+
+    return false;
+}
+
 Result Window::begin() {
     // Process surface bind and unbind queue.
     JST_CHECK(processSurfaceUnbindQueue());
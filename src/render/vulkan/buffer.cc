@@ -121,6 +121,7 @@ Result Implementation::update(const U64& offset, const U64& size) {
 
     memcpy(mappedData, hostData + byteOffset, byteSize);
 
+    std::lock_guard<std::mutex> lock(backend->getQueueMutex());
     JST_CHECK(Backend::ExecuteOnce(backend->getDevice(),
                                    backend->getComputeQueue(),
                                    backend->getDefaultFence(),
@@ -111,9 +111,12 @@ Result Implementation::destroy() {
 
 Result Implementation::encode(VkCommandBuffer& commandBuffer) {
     if (framebuffer->size(requestedSize)) {
-        JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
-            JST_ERROR("[VULKAN] Can't wait for graphics queue to finish for surface destruction.");
-        });
+        {
+            std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+            JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
+                JST_ERROR("[VULKAN] Can't wait for graphics queue to finish for surface destruction.");
+            });
+        }
             
         JST_CHECK(destroy());
         JST_CHECK(create());
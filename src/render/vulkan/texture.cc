@@ -234,6 +234,7 @@ Result Implementation::fillRow(const U64& y, const U64& height) {
 
     memcpy(mappedData, hostData + bufferByteOffset, bufferByteSize);
 
+    std::lock_guard<std::mutex> lock(backend->getQueueMutex());
     JST_CHECK(Backend::ExecuteOnce(backend->getDevice(),
                                    backend->getComputeQueue(),
                                    backend->getDefaultFence(),
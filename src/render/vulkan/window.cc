@@ -32,9 +32,12 @@ Result Implementation::unbindSurface(const std::shared_ptr<Surface>& surface) {
     JST_DEBUG("[VULKAN] Unbinding surface from window.");
 
     // Synchronize all outstanding command buffers.
-    JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
-        JST_ERROR("[VULKAN] Can't wait for queue to complete.");
-    });
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
+            JST_ERROR("[VULKAN] Can't wait for queue to complete.");
+        });
+    }
 
     // Cast generic Surface.
     auto _surface = std::dynamic_pointer_cast<SurfaceImp<Device::Vulkan>>(surface);
@@ -149,9 +152,12 @@ Result Implementation::destroy() {
 
     auto& device = Backend::State<Device::Vulkan>()->getDevice();
 
-    JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
-        JST_ERROR("[VULKAN] Can't wait for graphics queue to destroy window.");
-    });
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
+            JST_ERROR("[VULKAN] Can't wait for graphics queue to destroy window.");
+        });
+    }
 
     if (config.imgui) {
         JST_CHECK(destroyImgui());
@@ -214,9 +220,12 @@ Result Implementation::createFramebuffer() {
 Result Implementation::destroyFramebuffer() {
     auto& device = Backend::State<Device::Vulkan>()->getDevice();
 
-    JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
-        JST_ERROR("[VULKAN] Can't wait for graphics queue to destroy framebuffer.");
-    });
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        JST_VK_CHECK(vkQueueWaitIdle(Backend::State<Device::Vulkan>()->getGraphicsQueue()), [&]{
+            JST_ERROR("[VULKAN] Can't wait for graphics queue to destroy framebuffer.");
+        });
+    }
 
     for (auto framebuffer : swapchainFramebuffers) {
         vkDestroyFramebuffer(device, framebuffer, nullptr);
@@ -260,6 +269,7 @@ Result Implementation::createImgui() {
     };
     ImGui_ImplVulkan_Init(&init_info, renderPass); 
 
+    std::lock_guard<std::mutex> lock(backend->getQueueMutex());
     JST_CHECK(Backend::ExecuteOnce(backend->getDevice(),
                                    backend->getComputeQueue(),
                                    backend->getDefaultFence(),
@@ -405,9 +415,12 @@ Result Implementation::end() {
     vkResetFences(device, 1, &inFlightFences[currentFrame]);
 
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
-    if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
-        JST_ERROR("[VULKAN] Failed to submit draw command buffer.");
-        return Result::ERROR;
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
+            JST_ERROR("[VULKAN] Failed to submit draw command buffer.");
+            return Result::ERROR;
+        }
     }
 
     currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
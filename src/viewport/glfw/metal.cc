@@ -115,5 +115,13 @@ bool Implementation::keepRunning() {
     return !glfwWindowShouldClose(window) && keepRunningFlag;
 }
 
+bool Implementation::resizePending() const {
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    const auto size = swapchain->drawableSize();
+    return static_cast<CGFloat>(width) != size.width ||
+           static_cast<CGFloat>(height) != size.height;
+}
+
 }  // namespace Jetstream::Viewport 
 
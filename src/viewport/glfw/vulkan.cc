@@ -248,7 +248,11 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
     presentInfo.pImageIndices = &_currentDrawableIndex;
 
     auto& presentQueue = Backend::State<Device::Vulkan>()->getPresentQueue();
-    const VkResult result = vkQueuePresentKHR(presentQueue, &presentInfo);
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        result = vkQueuePresentKHR(presentQueue, &presentInfo);
+    }
 
     if (result == VK_ERROR_OUT_OF_DATE_KHR ||
         result == VK_SUBOPTIMAL_KHR || 
@@ -359,4 +363,8 @@ bool Implementation::keepRunning() {
     return (!glfwWindowShouldClose(window)) && keepRunningFlag;
 }
 
+bool Implementation::resizePending() const {
+    return framebufferDidResize;
+}
+
 }  // namespace Jetstream::Viewport 
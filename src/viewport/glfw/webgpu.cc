@@ -148,4 +148,9 @@ bool Implementation::keepRunning() {
     return !glfwWindowShouldClose(window);
 }
 
+bool Implementation::resizePending() const {
+    return getWindowWidth() != static_cast<int>(swapchainSize.width) ||
+           getWindowHeight() != static_cast<int>(swapchainSize.height);
+}
+
 }  // namespace Jetstream::Viewport
@@ -292,7 +292,10 @@ Result Implementation::nextDrawable(VkSemaphore& semaphore) {
     submitInfo.pSignalSemaphores = &semaphore;
 
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
-    vkQueueSubmit(graphicsQueue, 1, &submitInfo, nullptr);
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        vkQueueSubmit(graphicsQueue, 1, &submitInfo, nullptr);
+    }
 
     return Result::SUCCESS;
 }
@@ -351,9 +354,12 @@ Result Implementation::commitDrawable(std::vector<VkSemaphore>& semaphores) {
     vkResetFences(device, 1, &swapchainFences[_currentDrawableIndex]);
 
     auto& graphicsQueue = Backend::State<Device::Vulkan>()->getGraphicsQueue();
-    JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, swapchainFences[_currentDrawableIndex]), [&]{
-        JST_ERROR("[VULKAN] Can't submit headless queue.");            
-    });
+    {
+        std::lock_guard<std::mutex> lock(Backend::State<Device::Vulkan>()->getQueueMutex());
+        JST_VK_CHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, swapchainFences[_currentDrawableIndex]), [&]{
+            JST_ERROR("[VULKAN] Can't submit headless queue.");            
+        });
+    }
 
     // Submit frame to endpoint.
 
@@ -1,4 +1,5 @@
 #include "jetstream/viewport/plugins/endpoint.hh"
+#include "jetstream/backend/base.hh"
 #include "jetstream/backend/devices/cpu/helpers.hh"
 
 #include <sys/stat.h>
@@ -53,6 +54,7 @@ Result Endpoint::create(const Viewport::Config& _config, const Device& _viewport
 
     config = _config;
     viewportDevice = _viewport_device;
+    latency = Latency::Tracker("endpoint");
 
     // Check if endpoint is valid.
 
@@ -243,6 +245,11 @@ Result Endpoint::createSocketEndpoint() {
 
     brokerEndpointRunning = true;
     brokerEndpointThread = std::thread([&]() {
+        // The broker serves the display side. Keep it off the compute core.
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        Backend::State<Device::CPU>()->applyThreadPolicy(Backend::CPU::ThreadRole::Render);
+#endif
+
         while (brokerEndpointRunning) {
             // Accept connection.
 
@@ -911,6 +918,8 @@ void Endpoint::OnBufferReleaseCallback(gpointer user_data) {
 #endif
 
 Result Endpoint::pushNewFrame(const void* data) {
+    const auto pushTime = Latency::Clock::now();
+
 #ifndef JST_OS_WINDOWS
     if (type == Endpoint::Type::Pipe) {
         write(pipeFileDescriptor, data, config.size.width * config.size.height * 4);
@@ -976,6 +985,15 @@ Result Endpoint::pushNewFrame(const void* data) {
     }
 #endif
 
+    // Account for the encode only once per computed frame.
+    const auto displayed = Latency::Displayed();
+    if (displayed != Latency::Timestamp{} && displayed != lastDisplayed) {
+        const auto now = Latency::Clock::now();
+        latency.record(Latency::Stage::Encode, now - pushTime);
+        latency.record(Latency::Stage::Total, now - displayed);
+        lastDisplayed = displayed;
+    }
+
     return Result::SUCCESS;
 }
 
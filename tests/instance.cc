@@ -0,0 +1,292 @@
+#include <chrono>
+#include <vector>
+#include <cassert>
+
+#include "jetstream/instance.hh"
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/concat.hh"
+#include "jetstream/modules/scale.hh"
+
+// Drives a headless instance from the test loop with the pull-mode API.
+
+using namespace Jetstream;
+
+int main() {
+    JST_CHECK_THROW(Backend::Initialize<Device::CPU>({}));
+
+    {
+        const U64 size = 4096;
+
+        std::vector<F32> first(size, 2.0f);
+        std::vector<F32> second(size, 3.0f);
+        std::vector<F32> gain(size, 0.5f);
+
+        Tensor<Device::CPU, F32> samples(first.data(), {size});
+        samples.set_locale({"host", "", "samples"});
+
+        Tensor<Device::CPU, F32> factor(gain.data(), {size});
+        factor.set_locale({"host", "", "gain"});
+
+        Instance instance;
+
+        std::shared_ptr<Multiply<Device::CPU, F32>> multiply;
+        const Result added = instance.addModule(multiply, "mul", {}, {
+            .factorA = samples,
+            .factorB = factor,
+        });
+        assert(added == Result::SUCCESS);
+
+        // Modules without a consumer are pruned by the scheduler.
+        std::shared_ptr<Multiply<Device::CPU, F32>> square;
+        const Result squareAdded = instance.addModule(square, "sqr", {}, {
+            .factorA = multiply->getOutputProduct(),
+            .factorB = multiply->getOutputProduct(),
+        });
+        assert(squareAdded == Result::SUCCESS);
+
+        // The first step computes the memory the input was built with.
+        const Result firstStep = instance.step();
+        assert(firstStep == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> product;
+        const Result pulled = instance.pull({"main", "mul", "product"}, product);
+        assert(pulled == Result::SUCCESS);
+        assert(product.size() == size);
+        for (U64 i = 0; i < size; i++) {
+            assert(product[i] == 1.0f);
+        }
+
+        Tensor<Device::CPU, F32> squared;
+        const Result pulledSquare = instance.pull({"main", "sqr", "product"}, squared);
+        assert(pulledSquare == Result::SUCCESS);
+        for (U64 i = 0; i < size; i++) {
+            assert(squared[i] == 1.0f);
+        }
+
+        // Pushed memory is read by the next step without rebuilding the graph.
+        const Result pushed = instance.push({"host", "", "samples"}, second.data());
+        assert(pushed == Result::SUCCESS);
+        assert(samples.data() == second.data());
+
+        const Result secondStep = instance.step();
+        assert(secondStep == Result::SUCCESS);
+        for (U64 i = 0; i < size; i++) {
+            assert(product[i] == 1.5f);
+            assert(squared[i] == 2.25f);
+        }
+
+        // Unknown inputs and outputs of another type are rejected.
+        const Result unknown = instance.push({"host", "", "missing"}, first.data());
+        assert(unknown == Result::ERROR);
+
+        Tensor<Device::CPU, CF32> mismatched;
+        const Result wrongType = instance.pull({"main", "mul", "product"}, mismatched);
+        assert(wrongType == Result::ERROR);
+
+        JST_INFO("Pull mode test successful!");
+
+        // Step overhead with a graph that does almost no work.
+
+        const U64 iterations = 10000;
+        const auto start = std::chrono::steady_clock::now();
+        for (U64 i = 0; i < iterations; i++) {
+            const Result pushedFrame = instance.push({"host", "", "samples"}, ((i % 2) ? first : second).data());
+            const Result steppedFrame = instance.step();
+            assert(pushedFrame == Result::SUCCESS);
+            assert(steppedFrame == Result::SUCCESS);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const F64 usPerStep = std::chrono::duration<F64, std::micro>(elapsed).count() / iterations;
+
+        const Result destroyed = instance.destroy();
+        assert(destroyed == Result::SUCCESS);
+
+        // Compare with the same modules alone to isolate the push and step cost.
+
+        auto graph = NewGraph(Device::CPU);
+        auto module = std::make_shared<Multiply<Device::CPU, F32>>();
+        module->init_benchmark_mode({}, {.factorA = samples, .factorB = factor});
+        const Result created = module->create();
+        assert(created == Result::SUCCESS);
+        auto moduleSquare = std::make_shared<Multiply<Device::CPU, F32>>();
+        moduleSquare->init_benchmark_mode({}, {
+            .factorA = module->getOutputProduct(),
+            .factorB = module->getOutputProduct(),
+        });
+        const Result createdSquare = moduleSquare->create();
+        assert(createdSquare == Result::SUCCESS);
+        const Result set = graph->setModule(module);
+        assert(set == Result::SUCCESS);
+        const Result setSquare = graph->setModule(moduleSquare);
+        assert(setSquare == Result::SUCCESS);
+        const Result graphCreated = graph->create();
+        assert(graphCreated == Result::SUCCESS);
+
+        const auto graphStart = std::chrono::steady_clock::now();
+        for (U64 i = 0; i < iterations; i++) {
+            const Result computed = graph->compute();
+            assert(computed == Result::SUCCESS);
+        }
+        const auto graphElapsed = std::chrono::steady_clock::now() - graphStart;
+        const F64 usPerCompute = std::chrono::duration<F64, std::micro>(graphElapsed).count() / iterations;
+
+        const Result graphDestroyed = graph->destroy();
+        assert(graphDestroyed == Result::SUCCESS);
+
+        JST_INFO("Push and step: {:.2f} us | Graph compute: {:.2f} us | Overhead: {:.2f} us",
+                 usPerStep, usPerCompute, usPerStep - usPerCompute);
+
+        // Microseconds, not milliseconds. The bound is loose for slow runners.
+        assert(usPerStep - usPerCompute < 1000.0);
+
+        JST_INFO("Step overhead test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U64 size = 1024;
+
+        std::vector<F32> first(size, 2.0f);
+        std::vector<F32> second(size, 3.0f);
+        std::vector<F32> gain(size, 0.5f);
+        std::vector<F32> tail(size, -1.0f);
+
+        Tensor<Device::CPU, F32> samples(first.data(), {size});
+        samples.set_locale({"host", "", "samples"});
+
+        Tensor<Device::CPU, F32> factor(gain.data(), {size});
+        factor.set_locale({"host", "", "gain"});
+
+        Tensor<Device::CPU, F32> padding(tail.data(), {size});
+        padding.set_locale({"host", "", "tail"});
+
+        Instance instance;
+
+        std::shared_ptr<Multiply<Device::CPU, F32>> multiply;
+        const Result added = instance.addModule(multiply, "mul", {}, {
+            .factorA = samples,
+            .factorB = factor,
+        });
+        assert(added == Result::SUCCESS);
+
+        // The product is placed inside the first concatenation.
+        std::shared_ptr<Concat<Device::CPU, F32>> firstConcat;
+        const Result firstAdded = instance.addModule(firstConcat, "cat1", {}, {
+            .bufferA = multiply->getOutputProduct(),
+            .bufferB = padding,
+        });
+        assert(firstAdded == Result::SUCCESS);
+
+        const Result firstStep = instance.step();
+        assert(firstStep == Result::SUCCESS);
+
+        // A second concatenation of the same product rebuilds the graph. It
+        // reads the first one, so it runs later and is offered the product
+        // first. The product can't leave the first one, so both copy it.
+        std::shared_ptr<Concat<Device::CPU, F32>> secondConcat;
+        const Result secondAdded = instance.addModule(secondConcat, "cat2", {}, {
+            .bufferA = multiply->getOutputProduct(),
+            .bufferB = firstConcat->getOutputBuffer(),
+        });
+        assert(secondAdded == Result::SUCCESS);
+
+        const Result pushed = instance.push({"host", "", "samples"}, second.data());
+        assert(pushed == Result::SUCCESS);
+
+        const Result secondStep = instance.step();
+        assert(secondStep == Result::SUCCESS);
+
+        const auto& firstJoined = firstConcat->getOutputBuffer();
+        const auto& secondJoined = secondConcat->getOutputBuffer();
+        assert(firstJoined.size() == 2 * size);
+        assert(secondJoined.size() == 3 * size);
+        for (U64 i = 0; i < size; i++) {
+            assert(firstJoined[i] == 1.5f);
+            assert(firstJoined[size + i] == -1.0f);
+            assert(secondJoined[i] == 1.5f);
+            assert(secondJoined[size + i] == 1.5f);
+            assert(secondJoined[2 * size + i] == -1.0f);
+        }
+
+        const Result destroyed = instance.destroy();
+        assert(destroyed == Result::SUCCESS);
+
+        JST_INFO("Placement rebuild test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U64 size = 1024;
+
+        std::vector<F32> first(size, 2.0f);
+        std::vector<F32> gain(size, 0.5f);
+
+        Tensor<Device::CPU, F32> samples(first.data(), {size});
+        samples.set_locale({"host", "", "samples"});
+
+        Tensor<Device::CPU, F32> factor(gain.data(), {size});
+        factor.set_locale({"host", "", "gain"});
+
+        Instance instance;
+
+        std::shared_ptr<Multiply<Device::CPU, F32>> multiply;
+        const Result added = instance.addModule(multiply, "mul", {}, {
+            .factorA = samples,
+            .factorB = factor,
+        });
+        assert(added == Result::SUCCESS);
+
+        // A single reader scales the product in-place.
+        std::shared_ptr<Scale<Device::CPU, F32>> firstScale;
+        const Result firstAdded = instance.addModule(firstScale, "scale1", {.range = {0.0f, 2.0f}}, {
+            .buffer = multiply->getOutputProduct(),
+        });
+        assert(firstAdded == Result::SUCCESS);
+
+        const Result firstStep = instance.step();
+        assert(firstStep == Result::SUCCESS);
+
+        const auto& product = multiply->getOutputProduct();
+        const auto& firstScaled = firstScale->getOutputBuffer();
+        assert(firstScaled.data() == product.data());
+        for (U64 i = 0; i < size; i++) {
+            assert(firstScaled[i] == 0.5f);
+        }
+
+        // A second reader of the product makes both writers copy it.
+        std::shared_ptr<Scale<Device::CPU, F32>> secondScale;
+        const Result secondAdded = instance.addModule(secondScale, "scale2", {.range = {-1.0f, 1.0f}}, {
+            .buffer = multiply->getOutputProduct(),
+        });
+        assert(secondAdded == Result::SUCCESS);
+
+        const Result secondStep = instance.step();
+        assert(secondStep == Result::SUCCESS);
+
+        const auto& secondScaled = secondScale->getOutputBuffer();
+        assert(firstScaled.data() != product.data());
+        assert(secondScaled.data() != product.data());
+        for (U64 i = 0; i < size; i++) {
+            assert(product[i] == 1.0f);
+            assert(firstScaled[i] == 0.5f);
+            assert(secondScaled[i] == 1.0f);
+        }
+
+        // The copies go back to the pool and the pool is trimmed on destroy.
+        const Result destroyed = instance.destroy();
+        assert(destroyed == Result::SUCCESS);
+        assert(TensorPool::Cached() == 0);
+
+        JST_INFO("Copy-on-write fan-out test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    JST_CHECK_THROW(Backend::DestroyAll());
+
+    JST_INFO("Test successful!");
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <random>
+#include <cassert>
+#include <functional>
+
+#include "jetstream/backend/devices/cpu/math.hh"
+
+using namespace Jetstream;
+using namespace Jetstream::Backend;
+
+// Checks the error bounds documented in the math header. The margin covers
+// contraction into FMA instructions on other targets.
+
+constexpr F64 Margin = 1.25;
+
+template<MathAccuracy A>
+void CheckAccuracy(const F64& log10Bound,
+                   const F64& atan2Bound,
+                   const F64& expBound,
+                   const F64& sincosBound) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<F32> magnitude(-6.0f, 6.0f);
+    std::uniform_real_distribution<F32> coordinate(-10.0f, 10.0f);
+    std::uniform_real_distribution<F32> exponent(-80.0f, 80.0f);
+    std::uniform_real_distribution<F32> angle(-1000.0f, 1000.0f);
+
+    F64 log10Error = 0.0;
+    F64 atan2Error = 0.0;
+    F64 expError = 0.0;
+    F64 sincosError = 0.0;
+
+    for (U64 i = 0; i < 1000000; i++) {
+        const F32 a = std::pow(10.0f, magnitude(generator));
+        log10Error = std::max(log10Error, std::fabs(Log10<A>(a) - std::log10(static_cast<F64>(a))));
+
+        const F32 y = coordinate(generator);
+        const F32 x = coordinate(generator);
+        atan2Error = std::max(atan2Error, std::fabs(Atan2<A>(y, x) - std::atan2(static_cast<F64>(y),
+                                                                                static_cast<F64>(x))));
+
+        const F32 e = exponent(generator);
+        const F64 reference = std::exp(static_cast<F64>(e));
+        expError = std::max(expError, std::fabs(Exp<A>(e) - reference) / reference);
+
+        F32 sin, cos;
+        const F32 t = angle(generator);
+        SinCos<A>(t, sin, cos);
+        sincosError = std::max(sincosError, std::fabs(sin - std::sin(static_cast<F64>(t))));
+        sincosError = std::max(sincosError, std::fabs(cos - std::cos(static_cast<F64>(t))));
+    }
+
+    JST_INFO("Log10: {:.2e} | Atan2: {:.2e} | Exp: {:.2e} | SinCos: {:.2e}", log10Error,
+                                                                           atan2Error,
+                                                                           expError,
+                                                                           sincosError);
+
+    assert(log10Error <= log10Bound * Margin);
+    assert(atan2Error <= atan2Bound * Margin);
+    assert(expError <= expBound * Margin);
+    assert(sincosError <= sincosBound * Margin);
+}
+
+int main() {
+    {
+        CheckAccuracy<MathAccuracy::Fast>(4.1e-4, 5.0e-3, 8.0e-4, 3.3e-4);
+
+        JST_INFO("Fast accuracy test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        CheckAccuracy<MathAccuracy::Balanced>(8.3e-7, 2.0e-6, 2.6e-7, 1.2e-7);
+
+        JST_INFO("Balanced accuracy test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        // Edge cases of the folded Atan2.
+        assert(Atan2<MathAccuracy::Balanced>(0.0f, 0.0f) == 0.0f);
+        assert(std::fabs(Atan2<MathAccuracy::Balanced>(0.0f, -1.0f) - JST_PI) < 1e-6);
+        assert(std::fabs(Atan2<MathAccuracy::Balanced>(-1.0f, 0.0f) + JST_PI_2) < 1e-6);
+
+        // Array kernels match the scalar kernels.
+        F32 input[4] = {0.5f, 1.0f, 2.0f, 1000.0f};
+        F32 output[4];
+        Log10(MathAccuracy::Balanced, input, output, 4);
+        for (U64 i = 0; i < 4; i++) {
+            assert(output[i] == Log10<MathAccuracy::Balanced>(input[i]));
+        }
+
+        JST_INFO("Math kernels test successful!");
+    }
+
+    JST_INFO("Test successful!");
+
+    return 0;
+}
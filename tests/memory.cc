@@ -2,6 +2,7 @@
 #include <chrono>
 
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 // TODO: Use Catch2 to implement proper unit tests.
 // TODO: Drastically improve test coverage.
@@ -440,6 +441,289 @@ int main() {
 
     JST_INFO("---------------------------------------------");
 
+    {
+        Tensor<Device::CPU, F32> array({4, 8});
+        for (U64 i = 0; i < array.size(); i++) {
+            array[i] = i;
+        }
+
+        // Rows are dense views starting at an offset.
+        auto row = array;
+        row.view({2, {}});
+
+        assert(row.shape() == std::vector<U64>{8});
+        assert(row.offset() == 16);
+        assert(row.contiguous() == true);
+        assert(row[0] == 16);
+        assert((row[std::vector<U64>{3}] == 19));
+
+        // Views of views accumulate the offset.
+        row.view({{2, 6}});
+
+        assert(row.shape() == std::vector<U64>{4});
+        assert(row.offset() == 18);
+        assert(row[0] == 18);
+
+        // Columns are strided.
+        auto column = array;
+        column.view({{}, 3});
+
+        assert(column.shape() == std::vector<U64>{4});
+        assert(column.stride() == std::vector<U64>{8});
+        assert(column.contiguous() == false);
+        assert((column[std::vector<U64>{2}] == 19));
+
+        // Ellipsis expands to the leading dimensions.
+        Tensor<Device::CPU, F32> cube({2, 3, 4});
+        cube.view({"...", 1});
+
+        assert((cube.shape() == std::vector<U64>{2, 3}));
+        assert(cube.contiguous() == false);
+
+        JST_INFO("Tensor test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Tensor<Device::CPU, F32> source({16});
+        for (U64 i = 0; i < source.size(); i++) {
+            source[i] = i;
+        }
+
+        // Clones borrow the source memory.
+        Tensor<Device::CPU, F32> clone;
+        const Result cloned = source.copy_on_write(clone);
+        assert(cloned == Result::SUCCESS);
+
+        assert(clone.hash() != source.hash());
+        assert(clone.data() == source.data());
+        assert(clone.copy_on_write_state()->source_hash == source.hash());
+
+        // Private sources are written in-place.
+        clone.copy_on_write_state()->shared = false;
+        const Result privateWrite = clone.make_writable();
+        assert(privateWrite == Result::SUCCESS);
+        assert(clone.data() == source.data());
+
+        // Shared sources are copied on the first write.
+        clone.copy_on_write_state()->shared = true;
+        const Result sharedWrite = clone.make_writable();
+        assert(sharedWrite == Result::SUCCESS);
+        assert(clone.data() != source.data());
+        clone[3] = 42;
+        assert(clone[3] == 42);
+        assert(source[3] == 3);
+
+        // The copy is returned to the pool at the end of the frame.
+        const auto cached = TensorPool::Cached();
+        clone.copy_on_write_state()->reset();
+        assert(clone.data() == source.data());
+        assert(TensorPool::Cached() == cached + 1);
+
+        // Views publish a clone starting at their offset.
+        auto row = source;
+        const Result viewed = row.view({{4, 8}});
+        assert(viewed == Result::SUCCESS);
+        const Result rowCloned = row.copy_on_write(clone);
+        assert(rowCloned == Result::SUCCESS);
+        assert(clone.size() == 4);
+        assert(clone[0] == 4);
+
+        // Clones follow a source rebound after they were created.
+        std::vector<F32> first(4, 1.0f);
+        std::vector<F32> second(4, 2.0f);
+        Tensor<Device::CPU, F32> input(first.data(), {4});
+        const Result inputCloned = input.copy_on_write(clone);
+        assert(inputCloned == Result::SUCCESS);
+        const Result rebound = input.rebind(second.data());
+        assert(rebound == Result::SUCCESS);
+        assert(clone.data() == second.data());
+        assert(clone[0] == 2.0f);
+
+        JST_INFO("Tensor copy-on-write test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        std::vector<F32> first(8, 1.0f);
+        std::vector<F32> second(8, 2.0f);
+
+        // Copies of a raw pointer tensor follow the rebound memory.
+        Tensor<Device::CPU, F32> input(first.data(), {8});
+        auto consumer = input;
+        assert(consumer[0] == 1.0f);
+
+        const Result rebound = input.rebind(second.data());
+        assert(rebound == Result::SUCCESS);
+        assert(consumer.data() == second.data());
+        assert(consumer[0] == 2.0f);
+
+        // Owned memory cannot be rebound.
+        Tensor<Device::CPU, F32> owned({8});
+        const Result ownedRebound = owned.rebind(first.data());
+        assert(ownedRebound == Result::ERROR);
+
+        JST_INFO("Tensor rebind test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Tensor<Device::CPU, F32> stream({12});
+        for (U64 i = 0; i < stream.size(); i++) {
+            stream[i] = i;
+        }
+
+        // Frames of 4 samples every 2 samples share half of their memory.
+        auto frames = stream;
+        const Result framed = frames.as_strided({5, 4}, {2, 1});
+        assert(framed == Result::SUCCESS);
+        assert(frames.contiguous() == false);
+        assert(frames.size() == 20);
+        assert(frames.data() == stream.data());
+        assert((frames[{1, 0}] == 2));
+        assert((frames[{4, 3}] == 11));
+
+        // Non-overlapping frames are a dense reshape.
+        auto blocks = stream;
+        const Result blocked = blocks.as_strided({3, 4}, {4, 1});
+        assert(blocked == Result::SUCCESS);
+        assert(blocks.contiguous() == true);
+
+        // Frames reaching past the source are rejected.
+        auto invalid = stream;
+        const Result overrun = invalid.as_strided({6, 4}, {2, 1});
+        assert(overrun == Result::ERROR);
+
+        JST_INFO("Tensor strided view test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Tensor<Device::CPU, F32> matrix({2, 3});
+        for (U64 i = 0; i < matrix.size(); i++) {
+            matrix[i] = static_cast<F32>(i);
+        }
+
+        // Swapping the axes only reorders shape and stride.
+        auto transposed = matrix;
+        const Result permuted = transposed.permute({1, 0});
+        assert(permuted == Result::SUCCESS);
+        assert((transposed.shape() == std::vector<U64>{3, 2}));
+        assert((transposed.stride() == std::vector<U64>{1, 3}));
+        assert(transposed.contiguous() == false);
+        assert(transposed.data() == matrix.data());
+        assert((transposed[{2, 1}] == matrix[{1, 2}]));
+
+        // Permuting back restores a dense tensor.
+        const Result restored = transposed.permute({1, 0});
+        assert(restored == Result::SUCCESS);
+        assert(transposed.contiguous() == true);
+
+        // Axes must be a permutation of the tensor rank.
+        auto invalid = matrix;
+        const Result repeated = invalid.permute({0, 0});
+        assert(repeated == Result::ERROR);
+        const Result truncated = invalid.permute({0});
+        assert(truncated == Result::ERROR);
+        const Result outOfRange = invalid.permute({0, 2});
+        assert(outOfRange == Result::ERROR);
+
+        JST_INFO("Tensor permute test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Tensor<Device::CPU, F32> cube({3, 40, 70});
+        for (U64 i = 0; i < cube.size(); i++) {
+            cube[i] = static_cast<F32>(i);
+        }
+
+        // Permuted views are walked in tiles but still visit every element.
+        auto view = cube;
+        const Result permuted = view.permute({0, 2, 1});
+        assert(permuted == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> iterated(view.shape());
+        Memory::CPU::AutomaticIterator([](const auto& in, auto& out) {
+            out = in;
+        }, view, iterated);
+
+        Tensor<Device::CPU, F32> blocked(view.shape());
+        for (U64 b = 0; b < 3; b++) {
+            Memory::CPU::BlockedTranspose(cube.data() + b * 40 * 70, blocked.data() + b * 70 * 40, 40, 70, 70, 40);
+        }
+
+        for (U64 b = 0; b < 3; b++) {
+            for (U64 r = 0; r < 70; r++) {
+                for (U64 c = 0; c < 40; c++) {
+                    assert((iterated[{b, r, c}] == cube[{b, c, r}]));
+                    assert((blocked[{b, r, c}] == cube[{b, c, r}]));
+                }
+            }
+        }
+
+        JST_INFO("Tensor permuted iteration test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Tensor<Device::CPU, F32> output({2, 4});
+        Tensor<Device::CPU, F32> producer({4});
+        auto consumer = producer;
+
+        auto slot = output;
+        const Result sliced = slot.view({1, {}});
+        assert(sliced == Result::SUCCESS);
+        assert(slot.contiguous() == true);
+
+        // The producer and every tensor sharing its buffer move into the slot.
+        const Result placed = producer.place(slot);
+        assert(placed == Result::SUCCESS);
+        assert(consumer.data() == output.data() + 4);
+        producer[2] = 7.0f;
+        assert((output[{1, 2}] == 7.0f));
+
+        // Placing again into the same slot changes nothing.
+        const Result replaced = producer.place(slot);
+        assert(replaced == Result::SUCCESS);
+
+        // A placed buffer stays in its slot. Its host keeps reading it there.
+        Tensor<Device::CPU, F32> other({2, 4});
+        auto otherSlot = other;
+        const Result otherSliced = otherSlot.view({0, {}});
+        assert(otherSliced == Result::SUCCESS);
+        const Result moved = producer.place(otherSlot);
+        assert(moved == Result::ERROR);
+        assert(consumer.data() == output.data() + 4);
+
+        // Buffers holding placed tensors, mismatched slots and caller memory can't be placed.
+        Tensor<Device::CPU, F32> outer({3, 4});
+        auto rows = outer;
+        const Result rowsSliced = rows.view({{0, 2}, {}});
+        assert(rowsSliced == Result::SUCCESS);
+        const Result hosting = output.place(rows);
+        assert(hosting == Result::ERROR);
+
+        Tensor<Device::CPU, F32> larger({8});
+        const Result mismatched = larger.place(slot);
+        assert(mismatched == Result::ERROR);
+
+        std::vector<F32> memory(4);
+        Tensor<Device::CPU, F32> wrapped(memory.data(), {4});
+        const Result external = wrapped.place(slot);
+        assert(external == Result::ERROR);
+
+        JST_INFO("Tensor placement test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
 #ifdef JETSTREAM_BACKEND_METAL_AVAILABLE
     {
         Tensor<Device::CPU, F32> b({42});
@@ -486,6 +770,32 @@ int main() {
 
     JST_INFO("---------------------------------------------");
 
+    {
+        Tensor<Device::CPU, F32> array({4, 8});
+
+        // A row view starts past the base of the allocation.
+        auto row = array;
+        const Result viewed = row.view({1, {}});
+        assert(viewed == Result::SUCCESS);
+        assert(row.offset() == 8);
+
+        bool rejected = false;
+        try {
+            Tensor<Device::Metal, F32> clone(row);
+        } catch (const Result&) {
+            rejected = true;
+        }
+        assert(rejected);
+
+        // The dense tensor still clones.
+        Tensor<Device::Metal, F32> clone(array);
+        assert(clone.size() == 32);
+
+        JST_INFO("Tensor cross-device view rejection test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
     {
         Tensor<Device::Metal, F32> metal_array({1, 2, 3});
         PrintVarDebug("metal_array", metal_array);
@@ -0,0 +1,109 @@
+#include <thread>
+#include <chrono>
+#include <cassert>
+
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "jetstream/metrics.hh"
+#include "jetstream/memory/buffer.hh"
+
+using namespace Jetstream;
+
+// Scrape the exporter like Prometheus would.
+
+std::string Scrape(const U16& port) {
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    assert(fd >= 0);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+    const int connected = connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    assert(connected == 0);
+
+    const std::string request = "GET /metrics HTTP/1.0\r\n\r\n";
+    const ssize_t sent = send(fd, request.data(), request.size(), 0);
+    assert(sent == static_cast<ssize_t>(request.size()));
+
+    std::string response;
+    char chunk[1024];
+    ssize_t size;
+    while ((size = recv(fd, chunk, sizeof(chunk), 0)) > 0) {
+        response.append(chunk, size);
+    }
+    close(fd);
+
+    return response;
+}
+
+int main() {
+    {
+        auto& counter = Metrics::GetCounter("test_events_total", "Test counter.");
+        auto& gauge = Metrics::GetGauge("test_level", "Test gauge.", "source=\"a\"");
+        auto& histogram = Metrics::GetHistogram("test_latency_seconds", "Test histogram.");
+
+        counter.increment();
+        counter.increment(2);
+        gauge.set(0.5);
+        histogram.observe(75e-6);
+        histogram.observe(1.0);
+
+        assert(&counter == &Metrics::GetCounter("test_events_total", "Test counter."));
+        assert(counter.value() == 3);
+
+        const auto text = Metrics::RenderPrometheus();
+        assert(text.find("# TYPE test_events_total counter") != std::string::npos);
+        assert(text.find("test_events_total 3") != std::string::npos);
+        assert(text.find("test_level{source=\"a\"} 0.5") != std::string::npos);
+        assert(text.find("test_latency_seconds_bucket{le=\"0.0001\"} 1") != std::string::npos);
+        assert(text.find("test_latency_seconds_count 2") != std::string::npos);
+        assert(histogram.quantile(0.5) == Metrics::Histogram::Bound(1));
+
+        JST_INFO("Metrics registry test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        Memory::CircularBuffer<F32> buffer(8);
+        buffer.publishMetrics("test");
+
+        F32 data[6] = {};
+        const Result first = buffer.put(data, 6);
+        const Result second = buffer.put(data, 6);
+        assert(first == Result::SUCCESS);
+        assert(second == Result::SUCCESS);
+
+        const auto text = Metrics::RenderPrometheus();
+        assert(text.find("jetstream_buffer_overflows_total{buffer=\"test\"} 1") != std::string::npos);
+
+        JST_INFO("Circular buffer metrics test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U16 port = 19464;
+
+        const Result invalid = Metrics::StartExporter("127.0.0.1:metrics");
+        assert(invalid == Result::ERROR);
+
+        const Result started = Metrics::StartExporter(fmt::format("127.0.0.1:{}", port));
+        assert(started == Result::SUCCESS);
+
+        const auto response = Scrape(port);
+        assert(response.starts_with("HTTP/1.0 200 OK"));
+        assert(response.find("test_events_total 3") != std::string::npos);
+
+        const Result stopped = Metrics::Stop();
+        assert(stopped == Result::SUCCESS);
+
+        JST_INFO("Metrics exporter scrape test successful!");
+    }
+
+    return 0;
+}
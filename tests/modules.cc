@@ -0,0 +1,1015 @@
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <cassert>
+
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/fft.hh"
+#include "jetstream/modules/amplitude.hh"
+#include "jetstream/modules/scale.hh"
+#include "jetstream/modules/fused.hh"
+#include "jetstream/modules/tone_bank.hh"
+#include "jetstream/modules/cfar.hh"
+#include "jetstream/modules/cic.hh"
+#include "jetstream/modules/lineplot.hh"
+#include "jetstream/modules/spectrogram.hh"
+#include "jetstream/modules/callback_sink.hh"
+#include "jetstream/modules/frame.hh"
+#include "jetstream/modules/transpose.hh"
+
+// Checks CPU module chains against each other and against direct reference
+// math on small inputs.
+
+using namespace Jetstream;
+
+void Run(const std::vector<std::shared_ptr<Compute>>& modules) {
+    auto graph = NewGraph(Device::CPU);
+    for (const auto& module : modules) {
+        const Result set = graph->setModule(module);
+        assert(set == Result::SUCCESS);
+    }
+
+    const Result created = graph->create();
+    assert(created == Result::SUCCESS);
+    const Result computed = graph->compute();
+    assert(computed == Result::SUCCESS);
+    const Result destroyed = graph->destroy();
+    assert(destroyed == Result::SUCCESS);
+}
+
+// Empty inputs are rejected before the shape is divided.
+template<template<Device, typename> class M, typename T>
+void RejectEmpty() {
+    auto module = std::make_shared<M<Device::CPU, T>>();
+    module->init_benchmark_mode({}, {.buffer = Tensor<Device::CPU, T>()});
+    const Result created = module->create();
+    assert(created == Result::ERROR);
+}
+
+int main() {
+    JST_CHECK_THROW(Backend::Initialize<Device::CPU>({}));
+
+    {
+        const U64 batches = 4;
+        const U64 size = 1024;
+
+        Tensor<Device::CPU, CF32> signal({batches, size});
+        Tensor<Device::CPU, CF32> window({size});
+
+        std::mt19937 generator(42);
+        std::normal_distribution<F32> noise(0.0f, 1.0f);
+        for (U64 i = 0; i < signal.size(); i++) {
+            signal[i] = CF32(noise(generator), noise(generator));
+        }
+        for (U64 i = 0; i < size; i++) {
+            window[i] = 0.5f - 0.5f * std::cos(2.0f * JST_PI * i / (size - 1));
+        }
+
+        // Runtime graph (window multiply, FFT, amplitude, scale).
+
+        auto multiply = std::make_shared<Multiply<Device::CPU, CF32>>();
+        multiply->init_benchmark_mode({}, {.factorA = signal, .factorB = window});
+        const Result multiplyCreated = multiply->create();
+        assert(multiplyCreated == Result::SUCCESS);
+
+        auto fft = std::make_shared<FFT<Device::CPU, CF32>>();
+        fft->init_benchmark_mode({.forward = true}, {.buffer = multiply->getOutputProduct()});
+        const Result fftCreated = fft->create();
+        assert(fftCreated == Result::SUCCESS);
+
+        auto amplitude = std::make_shared<Amplitude<Device::CPU, CF32>>();
+        amplitude->init_benchmark_mode({}, {.buffer = fft->getOutputBuffer()});
+        const Result amplitudeCreated = amplitude->create();
+        assert(amplitudeCreated == Result::SUCCESS);
+
+        auto scale = std::make_shared<Scale<Device::CPU, F32>>();
+        scale->init_benchmark_mode({.range = {-100.0f, 0.0f}}, {.buffer = amplitude->getOutputBuffer()});
+        const Result scaleCreated = scale->create();
+        assert(scaleCreated == Result::SUCCESS);
+
+        Run({multiply, fft, amplitude, scale});
+
+        // Fused graph with the same stages around the FFT.
+
+        using Pre = Elementwise::Multiply<CF32>;
+        using Post = Elementwise::Chain<Elementwise::Amplitude<>, Elementwise::Scale>;
+
+        auto pre = std::make_shared<Fused<Device::CPU, Pre>>();
+        pre->init_benchmark_mode({.pipeline = Pre(window)}, {.buffer = signal});
+        const Result preCreated = pre->create();
+        assert(preCreated == Result::SUCCESS);
+
+        auto fusedFft = std::make_shared<FFT<Device::CPU, CF32>>();
+        fusedFft->init_benchmark_mode({.forward = true}, {.buffer = pre->getOutputBuffer()});
+        const Result fusedFftCreated = fusedFft->create();
+        assert(fusedFftCreated == Result::SUCCESS);
+
+        auto post = std::make_shared<Fused<Device::CPU, Post>>();
+        post->init_benchmark_mode({.pipeline = Elementwise::Amplitude() | Elementwise::Scale({-100.0f, 0.0f})},
+                                  {.buffer = fusedFft->getOutputBuffer()});
+        const Result postCreated = post->create();
+        assert(postCreated == Result::SUCCESS);
+
+        Run({pre, fusedFft, post});
+
+        // Both graphs should agree on every element, not only on the peaks.
+
+        const auto& product = multiply->getOutputProduct();
+        const auto& fusedProduct = pre->getOutputBuffer();
+        assert(fusedProduct.shape() == product.shape());
+        for (U64 i = 0; i < product.size(); i++) {
+            assert(std::abs(fusedProduct[i] - product[i]) <= 1e-6f * std::max(1.0f, std::abs(product[i])));
+        }
+
+        const auto& runtime = scale->getOutputBuffer();
+        const auto& fused = post->getOutputBuffer();
+        assert(fused.shape() == runtime.shape());
+        for (U64 i = 0; i < runtime.size(); i++) {
+            assert(std::abs(fused[i] - runtime[i]) <= 1e-5f);
+        }
+
+        JST_INFO("Fused pipeline test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U64 size = 256;
+        const U64 channels = 3;
+
+        // One tone per channel, laid out along the first axis.
+        Tensor<Device::CPU, CF32> columns({size, channels});
+        Tensor<Device::CPU, CF32> rows({channels, size});
+        for (U64 c = 0; c < channels; c++) {
+            const F32 bin = 11.3f + 40.0f * c;
+            for (U64 n = 0; n < size; n++) {
+                const F32 phase = 2.0f * JST_PI * bin * n / size;
+                columns[{n, c}] = CF32(std::cos(phase), std::sin(phase));
+                rows[{c, n}] = columns[{n, c}];
+            }
+        }
+
+        auto alongFirst = std::make_shared<FFT<Device::CPU, CF32>>();
+        alongFirst->init_benchmark_mode({.forward = true, .axes = {0}}, {.buffer = columns});
+        const Result firstCreated = alongFirst->create();
+        assert(firstCreated == Result::SUCCESS);
+
+        auto alongLast = std::make_shared<FFT<Device::CPU, CF32>>();
+        alongLast->init_benchmark_mode({.forward = true}, {.buffer = rows});
+        const Result lastCreated = alongLast->create();
+        assert(lastCreated == Result::SUCCESS);
+
+        Run({alongFirst, alongLast});
+
+        // Bin k of channel c should match on both layouts.
+
+        const auto& first = alongFirst->getOutputBuffer();
+        const auto& last = alongLast->getOutputBuffer();
+        assert((first.shape() == std::vector<U64>{size, channels}));
+        for (U64 c = 0; c < channels; c++) {
+            for (U64 k = 0; k < size; k++) {
+                assert(std::abs(first[{k, c}] - last[{c, k}]) <= 1e-5f * size);
+            }
+        }
+
+        JST_INFO("FFT axis test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U64 channels = 2;
+        const U64 samples = 512;
+        const U64 frames = 3;
+        const F32 sampleRate = 2.0e6f;
+
+        Tensor<Device::CPU, CF32> signal({channels, samples});
+        std::vector<CF32> stream(channels * samples * frames);
+
+        std::mt19937 generator(7);
+        std::normal_distribution<F32> noise(0.0f, 0.1f);
+        for (U64 c = 0; c < channels; c++) {
+            for (U64 n = 0; n < samples * frames; n++) {
+                const F32 phase = 2.0f * JST_PI * (0.25e6f + 0.1e6f * c) * n / sampleRate;
+                stream[c * samples * frames + n] = CF32(std::cos(phase) + noise(generator),
+                                                        std::sin(phase) + noise(generator));
+            }
+        }
+
+        // The window is longer than the hop and spans frames.
+
+        auto bank = std::make_shared<ToneBank<Device::CPU, CF32>>();
+        bank->init_benchmark_mode({
+            .frequencies = {0.25e6f, 0.35e6f, -0.6e6f},
+            .sampleRate = sampleRate,
+            .window = 384,
+            .hop = 128,
+        }, {.buffer = signal});
+        const Result bankCreated = bank->create();
+        assert(bankCreated == Result::SUCCESS);
+
+        const auto& config = bank->getConfig();
+        const U64 bins = config.frequencies.size();
+        const U64 outputs = samples / config.hop;
+
+        auto graph = NewGraph(Device::CPU);
+        const Result set = graph->setModule(bank);
+        assert(set == Result::SUCCESS);
+        const Result created = graph->create();
+        assert(created == Result::SUCCESS);
+
+        for (U64 f = 0; f < frames; f++) {
+            for (U64 c = 0; c < channels; c++) {
+                for (U64 n = 0; n < samples; n++) {
+                    signal[{c, n}] = stream[c * samples * frames + f * samples + n];
+                }
+            }
+
+            const Result computed = graph->compute();
+            assert(computed == Result::SUCCESS);
+
+            // Each bin is the DFT of the last `window` samples at its frequency.
+
+            const auto& spectrum = bank->getOutputBuffer();
+            for (U64 c = 0; c < channels; c++) {
+                const CF32* history = stream.data() + c * samples * frames;
+                for (U64 k = 0; k < bins; k++) {
+                    const F64 omega = 2.0 * JST_PI * config.frequencies[k] / sampleRate;
+                    for (U64 t = 0; t < outputs; t++) {
+                        const U64 end = f * samples + (t + 1) * config.hop;
+                        std::complex<F64> expected = 0.0;
+                        for (U64 m = 0; m < std::min(config.window, end); m++) {
+                            expected += std::complex<F64>(history[end - 1 - m]) * std::polar(1.0, omega * m);
+                        }
+                        const auto actual = std::complex<F64>(spectrum[{c, k, t}]);
+                        assert(std::abs(actual - expected) <= 1e-3 * config.window);
+                    }
+                }
+            }
+        }
+
+        const Result destroyed = graph->destroy();
+        assert(destroyed == Result::SUCCESS);
+
+        RejectEmpty<ToneBank, CF32>();
+
+        JST_INFO("Tone bank test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        const U64 batches = 2;
+        const U64 bins = 256;
+
+        Tensor<Device::CPU, F32> spectrum({batches, bins});
+
+        std::mt19937 generator(11);
+        std::uniform_real_distribution<F32> floor(-81.0f, -79.0f);
+        for (U64 i = 0; i < spectrum.size(); i++) {
+            spectrum[i] = floor(generator);
+        }
+
+        // Peaks on both edges and a run of three bins reported at its middle.
+        spectrum[{0, 0}] = -40.0f;
+        spectrum[{0, 100}] = -50.0f;
+        spectrum[{0, 101}] = -45.0f;
+        spectrum[{0, 102}] = -50.0f;
+        spectrum[{0, 180}] = -48.0f;
+        spectrum[{0, bins - 1}] = -42.0f;
+
+        // More peaks than detection rows.
+        for (U64 i = 10; i < bins; i += 24) {
+            spectrum[{1, i}] = -50.0f;
+        }
+
+        // Naive scan of every training window.
+        const auto reference = [&](const auto& config, const U64& b) {
+            const U64 reach = config.guard + config.training;
+            std::vector<F32> snr(bins);
+
+            for (U64 i = 0; i < bins; i++) {
+                std::vector<F32> cells;
+                for (U64 j = 0; j < bins; j++) {
+                    const U64 distance = (j > i) ? j - i : i - j;
+                    if (distance > config.guard && distance <= reach) {
+                        cells.push_back(spectrum[{b, j}]);
+                    }
+                }
+
+                F32 noise = spectrum[{b, i}];
+                if (!cells.empty() && config.mode == "ca") {
+                    F64 sum = 0.0;
+                    for (const auto& cell : cells) {
+                        sum += std::pow(10.0, cell / 10.0);
+                    }
+                    noise = static_cast<F32>(10.0 * std::log10(sum / cells.size()));
+                }
+                if (!cells.empty() && config.mode == "os") {
+                    std::sort(cells.begin(), cells.end());
+                    noise = cells[static_cast<U64>(config.rank * static_cast<F32>(cells.size() - 1))];
+                }
+                snr[i] = spectrum[{b, i}] - noise;
+            }
+
+            std::vector<U64> peaks;
+            for (U64 i = 0; i < bins; i++) {
+                if (snr[i] <= config.threshold) {
+                    continue;
+                }
+                U64 peak = i;
+                while (i + 1 < bins && snr[i + 1] > config.threshold) {
+                    i++;
+                    if (spectrum[{b, i}] > spectrum[{b, peak}]) {
+                        peak = i;
+                    }
+                }
+                peaks.push_back(peak);
+            }
+
+            return std::make_pair(peaks, snr);
+        };
+
+        for (const std::string mode : {"ca", "os"}) {
+            auto cfar = std::make_shared<CFAR<Device::CPU, F32>>();
+            cfar->init_benchmark_mode({
+                .mode = mode,
+                .training = 8,
+                .guard = 2,
+                .threshold = 15.0f,
+                .maxDetections = 8,
+            }, {.buffer = spectrum});
+            const Result cfarCreated = cfar->create();
+            assert(cfarCreated == Result::SUCCESS);
+
+            Run({cfar});
+
+            const auto& config = cfar->getConfig();
+            const auto& detections = cfar->getOutputDetections();
+            const auto& count = cfar->getOutputCount();
+            assert((detections.shape() == std::vector<U64>{batches, config.maxDetections, 3}));
+            assert((count.shape() == std::vector<U64>{batches}));
+
+            for (U64 b = 0; b < batches; b++) {
+                const auto [peaks, snr] = reference(config, b);
+                const U64 expected = std::min<U64>(peaks.size(), config.maxDetections);
+                assert(count[b] == expected);
+
+                for (U64 d = 0; d < expected; d++) {
+                    assert((detections[{b, d, 0}] == static_cast<F32>(peaks[d])));
+                    assert((detections[{b, d, 1}] == spectrum[{b, peaks[d]}]));
+                    assert((std::abs(detections[{b, d, 2}] - snr[peaks[d]]) <= 1e-3f));
+                }
+
+                // Rows after the last detection are padded.
+                for (U64 d = expected; d < config.maxDetections; d++) {
+                    assert((detections[{b, d, 0}] == -1.0f));
+                    assert((detections[{b, d, 1}] == 0.0f));
+                    assert((detections[{b, d, 2}] == 0.0f));
+                }
+            }
+
+            // Edges, the run and the cap are covered.
+            assert(count[0] == 4);
+            assert((detections[{0, 0, 0}] == 0.0f));
+            assert((detections[{0, 1, 0}] == 101.0f));
+            assert((detections[{0, 3, 0}] == static_cast<F32>(bins - 1)));
+            assert(count[1] == config.maxDetections);
+        }
+
+        RejectEmpty<CFAR, F32>();
+
+        JST_INFO("CFAR test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        // Each output is a boxcar of decimation · delay samples convolved
+        // with itself once per stage, evaluated at the last sample of its block.
+        const auto check = [](const U64& decimation, const U64& stages, const U64& delay, const bool& integer,
+                              const U64& channels, const U64& samples, const U64& frames) {
+            const U64 length = decimation * delay;
+            const U64 outputs = samples / decimation;
+
+            std::vector<F64> response = {1.0};
+            for (U64 s = 0; s < stages; s++) {
+                std::vector<F64> next(response.size() + length - 1, 0.0);
+                for (U64 i = 0; i < response.size(); i++) {
+                    for (U64 j = 0; j < length; j++) {
+                        next[i + j] += response[i] / length;
+                    }
+                }
+                response = std::move(next);
+            }
+
+            std::mt19937 generator(decimation + stages);
+            std::uniform_real_distribution<F32> amplitude(-0.5f, 0.5f);
+            std::vector<CF32> stream(channels * samples * frames);
+            for (auto& sample : stream) {
+                sample = CF32(amplitude(generator), amplitude(generator));
+            }
+
+            Tensor<Device::CPU, CF32> signal({channels, samples});
+
+            auto cic = std::make_shared<CIC<Device::CPU, CF32>>();
+            cic->init_benchmark_mode({
+                .decimation = decimation,
+                .stages = stages,
+                .delay = delay,
+                .integer = integer,
+            }, {.buffer = signal});
+            const Result cicCreated = cic->create();
+            assert(cicCreated == Result::SUCCESS);
+
+            auto graph = NewGraph(Device::CPU);
+            const Result set = graph->setModule(cic);
+            assert(set == Result::SUCCESS);
+            const Result created = graph->create();
+            assert(created == Result::SUCCESS);
+
+            F64 worst = 0.0;
+
+            for (U64 f = 0; f < frames; f++) {
+                for (U64 c = 0; c < channels; c++) {
+                    for (U64 n = 0; n < samples; n++) {
+                        signal[{c, n}] = stream[c * samples * frames + f * samples + n];
+                    }
+                }
+
+                const Result computed = graph->compute();
+                assert(computed == Result::SUCCESS);
+
+                // The response reaches into earlier frames.
+
+                const auto& decimated = cic->getOutputBuffer();
+                assert((decimated.shape() == std::vector<U64>{channels, outputs}));
+                for (U64 c = 0; c < channels; c++) {
+                    const CF32* history = stream.data() + c * samples * frames;
+                    for (U64 o = 0; o < outputs; o++) {
+                        const U64 newest = f * samples + (o + 1) * decimation - 1;
+                        std::complex<F64> expected = 0.0;
+                        for (U64 j = 0; j < response.size() && j <= newest; j++) {
+                            expected += response[j] * std::complex<F64>(history[newest - j]);
+                        }
+                        worst = std::max(worst, std::abs(std::complex<F64>(decimated[{c, o}]) - expected));
+                    }
+                }
+            }
+
+            const Result destroyed = graph->destroy();
+            assert(destroyed == Result::SUCCESS);
+
+            return worst;
+        };
+
+        for (const bool integer : {true, false}) {
+            const F64 small = check(8, 3, 1, integer, 3, 64, 6);
+            const F64 large = check(1024, 4, 2, integer, 2, 4096, 5);
+            JST_INFO("CIC {} error: {:.2e} (R=8, N=3, M=1), {:.2e} (R=1024, N=4, M=2)",
+                     integer ? "integer" : "float", small, large);
+            assert(small <= 1e-6);
+            assert(large <= 1e-6);
+        }
+
+        // A tone sweep over the passband. The compensation flattens the droop
+        // of the response to a fraction of its uncompensated value.
+        const auto sweep = [](const U64& taps) {
+            const U64 decimation = 16;
+            const U64 samples = 1024;
+            const F32 passband = 0.25f;
+
+            Tensor<Device::CPU, CF32> signal({samples});
+
+            auto cic = std::make_shared<CIC<Device::CPU, CF32>>();
+            cic->init_benchmark_mode({
+                .decimation = decimation,
+                .stages = 4,
+                .compensationTaps = taps,
+                .passband = passband,
+            }, {.buffer = signal});
+            const Result cicCreated = cic->create();
+            assert(cicCreated == Result::SUCCESS);
+
+            auto graph = NewGraph(Device::CPU);
+            const Result set = graph->setModule(cic);
+            assert(set == Result::SUCCESS);
+            const Result created = graph->create();
+            assert(created == Result::SUCCESS);
+
+            F64 lowest = std::numeric_limits<F64>::max();
+            F64 highest = std::numeric_limits<F64>::lowest();
+
+            // Tones up to 80% of the passband, in cycles per input sample.
+            for (U64 t = 0; t <= 8; t++) {
+                const F64 frequency = 0.8 * passband * t / 8.0 / decimation;
+
+                // The last frame is past the transients of both filters.
+                F64 gain = 0.0;
+                for (U64 f = 0; f < 3; f++) {
+                    for (U64 n = 0; n < samples; n++) {
+                        const F64 phase = 2.0 * JST_PI * frequency * (f * samples + n);
+                        signal[n] = CF32(0.5 * std::cos(phase), 0.5 * std::sin(phase));
+                    }
+
+                    const Result computed = graph->compute();
+                    assert(computed == Result::SUCCESS);
+
+                    const auto& decimated = cic->getOutputBuffer();
+                    gain = 0.0;
+                    for (U64 o = 0; o < decimated.size(); o++) {
+                        gain += std::abs(decimated[o]) / 0.5 / decimated.size();
+                    }
+                }
+
+                lowest = std::min(lowest, 20.0 * std::log10(gain));
+                highest = std::max(highest, 20.0 * std::log10(gain));
+            }
+
+            const Result destroyed = graph->destroy();
+            assert(destroyed == Result::SUCCESS);
+
+            return highest - lowest;
+        };
+
+        const F64 droop = sweep(0);
+        const F64 ripple = sweep(63);
+        JST_INFO("CIC passband droop: {:.3f} dB, compensated ripple: {:.3f} dB", droop, ripple);
+        assert(droop > 1.0);
+        assert(ripple < 0.1 * droop);
+
+        // Compensation needs zero or an odd number of at least three taps.
+        for (const U64 taps : {0, 1, 2, 3, 4}) {
+            auto cic = std::make_shared<CIC<Device::CPU, CF32>>();
+            cic->init_benchmark_mode({.decimation = 8, .compensationTaps = taps},
+                                     {.buffer = Tensor<Device::CPU, CF32>({64})});
+            const Result cicCreated = cic->create();
+            assert(cicCreated == ((taps == 0 || taps == 3) ? Result::SUCCESS : Result::ERROR));
+        }
+
+        RejectEmpty<CIC, CF32>();
+
+        JST_INFO("CIC test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+#if defined(JETSTREAM_MODULE_LINEPLOT_CPU_AVAILABLE) && defined(JETSTREAM_MODULE_SPECTROGRAM_CPU_AVAILABLE)
+    {
+        const U64 batches = 64;
+        const U64 elements = 32;
+        const U64 height = 16;
+        const U64 frames = 300;
+
+        Tensor<Device::CPU, F32> signal({batches, elements});
+
+        std::mt19937 generator(5);
+        std::uniform_real_distribution<F32> level(0.0f, 1.0f);
+
+        // One display refreshes every frame and the other one irregularly,
+        // including a long pause. Both should show the old per-frame result.
+
+        auto fastLineplot = std::make_shared<Lineplot<Device::CPU, F32>>();
+        auto slowLineplot = std::make_shared<Lineplot<Device::CPU, F32>>();
+        auto fastSpectrogram = std::make_shared<Spectrogram<Device::CPU, F32>>();
+        auto slowSpectrogram = std::make_shared<Spectrogram<Device::CPU, F32>>();
+
+        for (const auto& lineplot : {fastLineplot, slowLineplot}) {
+            lineplot->init_benchmark_mode({}, {.buffer = signal});
+            const Result lineplotCreated = lineplot->create();
+            assert(lineplotCreated == Result::SUCCESS);
+        }
+        for (const auto& spectrogram : {fastSpectrogram, slowSpectrogram}) {
+            spectrogram->init_benchmark_mode({.height = height}, {.buffer = signal});
+            const Result spectrogramCreated = spectrogram->create();
+            assert(spectrogramCreated == Result::SUCCESS);
+        }
+
+        auto graph = NewGraph(Device::CPU);
+        for (const auto& module : std::vector<std::shared_ptr<Compute>>{fastLineplot, slowLineplot,
+                                                                         fastSpectrogram, slowSpectrogram}) {
+            const Result set = graph->setModule(module);
+            assert(set == Result::SUCCESS);
+        }
+        const Result created = graph->create();
+        assert(created == Result::SUCCESS);
+
+        // Bins decayed once per frame, as the compute used to do.
+        const F32 decay = std::pow(0.999, batches);
+        std::vector<F32> bins(elements * height, 0.0f);
+
+        std::vector<F32> averages(elements, 0.0f);
+        U64 pending = 0;
+
+        for (U64 f = 0; f < frames; f++) {
+            for (U64 i = 0; i < signal.size(); i++) {
+                signal[i] = level(generator);
+            }
+
+            const Result computed = graph->compute();
+            assert(computed == Result::SUCCESS);
+
+            for (auto& bin : bins) {
+                bin *= decay;
+            }
+            for (U64 b = 0; b < batches; b++) {
+                for (U64 x = 0; x < elements; x++) {
+                    const U16 index = signal[{b, x}] * height;
+                    if (index < height && index > 0) {
+                        bins[x + (index * elements)] += 0.02f;
+                    }
+                }
+            }
+
+            for (U64 x = 0; x < elements; x++) {
+                F32 sum = 0.0f;
+                for (U64 b = 0; b < batches; b++) {
+                    sum += signal[{b, x}];
+                }
+                averages[x] += sum / (0.5f * batches) - 1.0f;
+            }
+            pending += 1;
+
+            const Result fastLineplotFinalized = static_cast<Present&>(*fastLineplot).finalize();
+            assert(fastLineplotFinalized == Result::SUCCESS);
+            const Result fastSpectrogramFinalized = static_cast<Present&>(*fastSpectrogram).finalize();
+            assert(fastSpectrogramFinalized == Result::SUCCESS);
+
+            // The line plot of a frame is the average of its batches.
+            const auto& fastPlot = fastLineplot->getPlot();
+            for (U64 x = 0; x < elements; x++) {
+                F32 sum = 0.0f;
+                for (U64 b = 0; b < batches; b++) {
+                    sum += signal[{b, x}];
+                }
+                assert(std::abs(fastPlot[{x, 1}] - (sum / (0.5f * batches) - 1.0f)) <= 1e-5f);
+            }
+
+            const bool refresh = (f % 7 == 3 && (f < 20 || f > 270)) || f == frames - 1;
+            if (!refresh) {
+                continue;
+            }
+
+            const Result slowLineplotFinalized = static_cast<Present&>(*slowLineplot).finalize();
+            assert(slowLineplotFinalized == Result::SUCCESS);
+            const Result slowSpectrogramFinalized = static_cast<Present&>(*slowSpectrogram).finalize();
+            assert(slowSpectrogramFinalized == Result::SUCCESS);
+
+            // A slower display averages the frames it skipped.
+            const auto& slowPlot = slowLineplot->getPlot();
+            for (U64 x = 0; x < elements; x++) {
+                assert(std::abs(slowPlot[{x, 1}] - averages[x] / pending) <= 1e-4f);
+            }
+            std::fill(averages.begin(), averages.end(), 0.0f);
+            pending = 0;
+
+            // The spectrogram doesn't depend on the display rate.
+            const auto& fastBins = fastSpectrogram->getFrequencyBins();
+            const auto& slowBins = slowSpectrogram->getFrequencyBins();
+            for (U64 i = 0; i < bins.size(); i++) {
+                assert(std::abs(fastBins[i] - bins[i]) <= 1e-4f * std::max(1.0f, bins[i]));
+                assert(std::abs(slowBins[i] - bins[i]) <= 1e-4f * std::max(1.0f, bins[i]));
+            }
+        }
+
+        const Result destroyed = graph->destroy();
+        assert(destroyed == Result::SUCCESS);
+
+        JST_INFO("Display accumulation test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+#endif
+
+    {
+        const U64 size = 16;
+        const U64 frames = 12;
+
+        Tensor<Device::CPU, F32> signal({size});
+
+        // Each frame carries its index, so deliveries can be checked in order.
+        const auto runFrames = [&](const std::shared_ptr<CallbackSink<Device::CPU, F32>>& sink,
+                                   const std::function<void()>& beforeDestroy) {
+            auto graph = NewGraph(Device::CPU);
+            const Result set = graph->setModule(sink);
+            assert(set == Result::SUCCESS);
+            const Result created = graph->create();
+            assert(created == Result::SUCCESS);
+
+            for (U64 f = 0; f < frames; f++) {
+                for (U64 i = 0; i < size; i++) {
+                    signal[i] = static_cast<F32>(f * size + i);
+                }
+                const Result computed = graph->compute();
+                assert(computed == Result::SUCCESS);
+            }
+
+            beforeDestroy();
+
+            const Result destroyed = graph->destroy();
+            assert(destroyed == Result::SUCCESS);
+        };
+
+        const auto frameIndex = [&](const Tensor<Device::CPU, F32>& buffer) {
+            for (U64 i = 0; i < size; i++) {
+                assert(buffer[i] == buffer[0] + i);
+            }
+            return static_cast<U64>(buffer[0]) / size;
+        };
+
+        // Inline delivery runs on the compute thread with the input itself.
+        {
+            std::vector<U64> delivered;
+            const auto computeThread = std::this_thread::get_id();
+
+            auto sink = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            sink->init_benchmark_mode({
+                .callback = [&](const Tensor<Device::CPU, F32>& buffer) {
+                    assert(std::this_thread::get_id() == computeThread);
+                    assert(buffer.data() == signal.data());
+                    delivered.push_back(frameIndex(buffer));
+                },
+            }, {.buffer = signal});
+            const Result sinkCreated = sink->create();
+            assert(sinkCreated == Result::SUCCESS);
+
+            runFrames(sink, []{});
+
+            assert(delivered.size() == frames);
+            for (U64 f = 0; f < frames; f++) {
+                assert(delivered[f] == f);
+            }
+            assert(sink->droppedFrames() == 0);
+        }
+
+        // With "drop", a stalled callback costs frames, never compute time.
+        {
+            const U64 queueDepth = 2;
+
+            std::atomic<bool> release{false};
+            std::atomic<U64> deliveredCount{0};
+            std::vector<U64> delivered;
+
+            auto sink = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            sink->init_benchmark_mode({
+                .dispatch = true,
+                .queueDepth = queueDepth,
+                .policy = "drop",
+                .callback = [&](const Tensor<Device::CPU, F32>& buffer) {
+                    while (!release.load()) {
+                        std::this_thread::yield();
+                    }
+                    delivered.push_back(frameIndex(buffer));
+                    deliveredCount.fetch_add(1);
+                },
+            }, {.buffer = signal});
+            const Result sinkCreated = sink->create();
+            assert(sinkCreated == Result::SUCCESS);
+
+            // Every compute returns while the first callback is still held.
+            runFrames(sink, [&]{
+                assert(deliveredCount.load() == 0);
+                assert(sink->droppedFrames() == frames - queueDepth);
+
+                release.store(true);
+                while (deliveredCount.load() < queueDepth) {
+                    std::this_thread::yield();
+                }
+            });
+
+            assert((delivered == std::vector<U64>{0, 1}));
+        }
+
+        // With "block", a slow callback still receives every frame in order.
+        {
+            std::atomic<U64> deliveredCount{0};
+            std::vector<U64> delivered;
+
+            auto sink = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            sink->init_benchmark_mode({
+                .dispatch = true,
+                .queueDepth = 2,
+                .policy = "block",
+                .callback = [&](const Tensor<Device::CPU, F32>& buffer) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    delivered.push_back(frameIndex(buffer));
+                    deliveredCount.fetch_add(1);
+                },
+            }, {.buffer = signal});
+            const Result sinkCreated = sink->create();
+            assert(sinkCreated == Result::SUCCESS);
+
+            runFrames(sink, [&]{
+                while (deliveredCount.load() < frames) {
+                    std::this_thread::yield();
+                }
+            });
+
+            assert(delivered.size() == frames);
+            for (U64 f = 0; f < frames; f++) {
+                assert(delivered[f] == f);
+            }
+            assert(sink->droppedFrames() == 0);
+        }
+
+        // Named callbacks are looked up when the module is created.
+        {
+            U64 calls = 0;
+            const Result registered = CallbackSink<Device::CPU, F32>::RegisterCallback("test-sink", [&](const auto&) {
+                calls += 1;
+            });
+            assert(registered == Result::SUCCESS);
+
+            auto named = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            named->init_benchmark_mode({.name = "test-sink"}, {.buffer = signal});
+            const Result namedCreated = named->create();
+            assert(namedCreated == Result::SUCCESS);
+
+            runFrames(named, []{});
+            assert(calls == frames);
+
+            const Result removed = CallbackSink<Device::CPU, F32>::RemoveCallback("test-sink");
+            assert(removed == Result::SUCCESS);
+
+            auto missing = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            missing->init_benchmark_mode({.name = "test-sink"}, {.buffer = signal});
+            const Result missingCreated = missing->create();
+            assert(missingCreated == Result::ERROR);
+
+            // Registered names are kept per type.
+            const Result otherRegistered = CallbackSink<Device::CPU, CF32>::RegisterCallback("test-sink", [](const auto&) {});
+            assert(otherRegistered == Result::SUCCESS);
+
+            auto otherType = std::make_shared<CallbackSink<Device::CPU, F32>>();
+            otherType->init_benchmark_mode({.name = "test-sink"}, {.buffer = signal});
+            const Result otherTypeCreated = otherType->create();
+            assert(otherTypeCreated == Result::ERROR);
+
+            const Result otherRemoved = CallbackSink<Device::CPU, CF32>::RemoveCallback("test-sink");
+            assert(otherRemoved == Result::SUCCESS);
+        }
+
+        JST_INFO("Callback sink test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        // Frames of each input, transformed, should match the transforms of
+        // frames taken from all inputs laid end to end.
+        const auto check = [](const U64& frameSize, const U64& hop) {
+            const U64 samples = 64;
+            const U64 inputs = 5;
+
+            std::mt19937 generator(frameSize + hop);
+            std::normal_distribution<F32> noise(0.0f, 1.0f);
+            std::vector<CF32> stream(samples * inputs);
+            for (auto& sample : stream) {
+                sample = CF32(noise(generator), noise(generator));
+            }
+
+            Tensor<Device::CPU, CF32> signal({samples});
+
+            auto frame = std::make_shared<Frame<Device::CPU, CF32>>();
+            frame->init_benchmark_mode({.frameSize = frameSize, .hop = hop}, {.buffer = signal});
+            const Result frameCreated = frame->create();
+            assert(frameCreated == Result::SUCCESS);
+
+            auto fft = std::make_shared<FFT<Device::CPU, CF32>>();
+            fft->init_benchmark_mode({.forward = true}, {.buffer = frame->getOutputBuffer()});
+            const Result fftCreated = fft->create();
+            assert(fftCreated == Result::SUCCESS);
+
+            auto graph = NewGraph(Device::CPU);
+            const Result frameSet = graph->setModule(frame);
+            assert(frameSet == Result::SUCCESS);
+            const Result fftSet = graph->setModule(fft);
+            assert(fftSet == Result::SUCCESS);
+            const Result created = graph->create();
+            assert(created == Result::SUCCESS);
+
+            const U64 frames = samples / hop;
+            const U64 carry = (frameSize > hop) ? frameSize - hop : 0;
+            U64 checked = 0;
+            F64 worst = 0.0;
+
+            for (U64 f = 0; f < inputs; f++) {
+                std::copy(stream.begin() + f * samples, stream.begin() + (f + 1) * samples, signal.begin());
+
+                const Result computed = graph->compute();
+                assert(computed == Result::SUCCESS);
+
+                const auto& spectra = fft->getOutputBuffer();
+                assert((spectra.shape() == std::vector<U64>{frames, frameSize}));
+
+                for (U64 j = 0; j < frames; j++) {
+                    // Overlapping frames begin with the tail of the previous input.
+                    if (f * samples + j * hop < carry) {
+                        continue;
+                    }
+                    const U64 start = f * samples + j * hop - carry;
+
+                    for (U64 k = 0; k < frameSize; k++) {
+                        std::complex<F64> expected = 0.0;
+                        for (U64 n = 0; n < frameSize; n++) {
+                            const F64 phase = -2.0 * JST_PI * static_cast<F64>(k * n) / frameSize;
+                            expected += std::complex<F64>(stream[start + n]) * std::polar(1.0, phase);
+                        }
+                        worst = std::max(worst, std::abs(std::complex<F64>(spectra[{j, k}]) - expected));
+                    }
+                    checked += 1;
+                }
+            }
+
+            const Result destroyed = graph->destroy();
+            assert(destroyed == Result::SUCCESS);
+
+            assert(checked >= (inputs - 1) * frames);
+            return worst;
+        };
+
+        // Overlapping, back to back, and with gaps between frames.
+        for (const auto& [frameSize, hop] : std::vector<std::pair<U64, U64>>{{32, 8}, {32, 16}, {32, 32}, {16, 32}}) {
+            const F64 worst = check(frameSize, hop);
+            JST_INFO("Frame {} hop {} error: {:.2e}", frameSize, hop, worst);
+            assert(worst <= 1e-4);
+        }
+
+        JST_INFO("Framed FFT test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        // Overlapping frames, like the ones published by the Frame module.
+        Tensor<Device::CPU, CF32> stream({64});
+        auto frames = stream;
+        const Result framed = frames.as_strided({7, 16}, {8, 1});
+        assert(framed == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> magnitudes({64});
+        auto overlapping = magnitudes;
+        const Result overlapped = overlapping.as_strided({7, 16}, {8, 1});
+        assert(overlapped == Result::SUCCESS);
+
+        // Modules that walk the buffer linearly should refuse strided views.
+
+        auto amplitude = std::make_shared<Amplitude<Device::CPU, CF32>>();
+        amplitude->init_benchmark_mode({}, {.buffer = frames});
+        const Result amplitudeCreated = amplitude->create();
+        assert(amplitudeCreated == Result::ERROR);
+
+        auto scale = std::make_shared<Scale<Device::CPU, F32>>();
+        scale->init_benchmark_mode({}, {.buffer = overlapping});
+        const Result scaleCreated = scale->create();
+        assert(scaleCreated == Result::ERROR);
+
+        JST_INFO("Strided input rejection test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    {
+        // Large enough to spread the batch of transposes across the workers.
+
+        const U64 batches = 8;
+        const U64 rows = 256;
+        const U64 cols = 192;
+
+        Tensor<Device::CPU, F32> input({batches, rows, cols});
+        for (U64 i = 0; i < input.size(); i++) {
+            input[i] = static_cast<F32>(i);
+        }
+
+        auto transpose = std::make_shared<Transpose<Device::CPU, F32>>();
+        transpose->init_benchmark_mode({.axes = {0, 2, 1}}, {.buffer = input});
+        const Result created = transpose->create();
+        assert(created == Result::SUCCESS);
+
+        Run({transpose});
+
+        const auto& output = transpose->getOutputBuffer();
+        assert((output.shape() == std::vector<U64>{batches, cols, rows}));
+        for (U64 b = 0; b < batches; b++) {
+            for (U64 r = 0; r < rows; r++) {
+                for (U64 c = 0; c < cols; c++) {
+                    assert((output[{b, c, r}] == input[{b, r, c}]));
+                }
+            }
+        }
+
+        JST_INFO("Parallel transpose test successful!");
+    }
+
+    JST_INFO("---------------------------------------------");
+
+    JST_CHECK_THROW(Backend::DestroyAll());
+
+    JST_INFO("Test successful!");
+
+    return 0;
+}
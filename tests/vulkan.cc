@@ -0,0 +1,324 @@
+#include <cmath>
+#include <vector>
+#include <cassert>
+
+#include "jetstream/modules/multiply.hh"
+#include "jetstream/modules/amplitude.hh"
+#include "jetstream/modules/scale.hh"
+#include "jetstream/modules/fft.hh"
+
+// Runs the Vulkan kernels against the reference CPU math. Meant to run on
+// any Vulkan implementation, including a software one like Mesa's lavapipe.
+
+using namespace Jetstream;
+
+template<Device D, template<Device, typename...> class Module, typename... Types>
+void Run(auto& module, const auto& config, const auto& input) {
+    auto graph = NewGraph(D);
+    module = std::make_shared<Module<D, Types...>>();
+    module->init_benchmark_mode(config, input);
+
+    const Result created = module->create();
+    assert(created == Result::SUCCESS);
+    const Result set = graph->setModule(module);
+    assert(set == Result::SUCCESS);
+    const Result graphCreated = graph->create();
+    assert(graphCreated == Result::SUCCESS);
+    const Result computed = graph->compute();
+    assert(computed == Result::SUCCESS);
+    const Result destroyed = graph->destroy();
+    assert(destroyed == Result::SUCCESS);
+}
+
+bool Close(const F32& a, const F32& b) {
+    return std::abs(a - b) <= 1e-3f * std::max(1.0f, std::abs(b));
+}
+
+int main() {
+    // Skip when there is no Vulkan device available.
+
+    try {
+        Backend::Config config;
+        config.headless = true;
+        JST_CHECK_THROW(Backend::Initialize<Device::Vulkan>(config));
+    } catch (...) {
+        JST_WARN("No Vulkan device available. Skipping.");
+        return 77;
+    }
+
+    // The results are read through a CPU view of the device memory.
+
+    if (!Backend::State<Device::Vulkan>()->hasUnifiedMemory()) {
+        JST_WARN("Vulkan device has no unified memory. Skipping.");
+        return 77;
+    }
+
+    const U64 size = 1024;
+
+    // Multiply (broadcast)
+
+    {
+        Tensor<Device::Vulkan, CF32> a({4, size});
+        Tensor<Device::Vulkan, CF32> b({1, size});
+
+        Tensor<Device::CPU, CF32> hostA(a);
+        Tensor<Device::CPU, CF32> hostB(b);
+
+        for (U64 i = 0; i < hostA.size(); i++) {
+            hostA[i] = CF32(i % 7, -1.0f);
+        }
+        for (U64 i = 0; i < hostB.size(); i++) {
+            hostB[i] = CF32(0.5f, i % 3);
+        }
+
+        std::shared_ptr<Multiply<Device::Vulkan, CF32>> module;
+        Run<Device::Vulkan, Multiply, CF32>(module, {}, {.factorA = a, .factorB = b});
+
+        Tensor<Device::CPU, CF32> product(module->getOutputProduct());
+        for (U64 i = 0; i < product.size(); i++) {
+            const auto expected = hostA[i] * hostB[i % size];
+            assert(Close(product[i].real(), expected.real()));
+            assert(Close(product[i].imag(), expected.imag()));
+        }
+    }
+
+    // Amplitude
+
+    {
+        Tensor<Device::Vulkan, CF32> buffer({size});
+        Tensor<Device::CPU, CF32> host(buffer);
+
+        for (U64 i = 0; i < host.size(); i++) {
+            host[i] = CF32(i + 1.0f, 2.0f);
+        }
+
+        std::shared_ptr<Amplitude<Device::Vulkan, CF32, F32>> module;
+        Run<Device::Vulkan, Amplitude, CF32, F32>(module, {}, {.buffer = buffer});
+
+        Tensor<Device::CPU, F32> output(module->getOutputBuffer());
+        for (U64 i = 0; i < output.size(); i++) {
+            assert(Close(output[i], 20.0f * std::log10(std::abs(host[i]) / size)));
+        }
+    }
+
+    // Scale
+
+    {
+        Tensor<Device::Vulkan, F32> buffer({size});
+        Tensor<Device::CPU, F32> host(buffer);
+
+        for (U64 i = 0; i < host.size(); i++) {
+            host[i] = -100.0f + i * 0.1f;
+        }
+
+        std::shared_ptr<Scale<Device::Vulkan, F32>> module;
+        Run<Device::Vulkan, Scale, F32>(module, {.range = {-100.0f, 0.0f}}, {.buffer = buffer});
+
+        Tensor<Device::CPU, F32> output(module->getOutputBuffer());
+        for (U64 i = 0; i < output.size(); i++) {
+            assert(Close(output[i], (host[i] + 100.0f) / 100.0f));
+        }
+    }
+
+    // FFT (off-center tone against the CPU transform)
+
+    {
+        Tensor<Device::Vulkan, CF32> buffer({2, size});
+        Tensor<Device::CPU, CF32> host(buffer);
+
+        // A fractional bin leaks into every other bin, so the whole spectrum
+        // is compared, not only the peak. Each batch has its own tone.
+
+        const F32 bins[2] = {37.3f, 301.7f};
+        for (U64 b = 0; b < 2; b++) {
+            for (U64 i = 0; i < size; i++) {
+                const F32 phase = 2.0f * JST_PI * bins[b] * i / size;
+                host[b * size + i] = CF32(std::cos(phase), std::sin(phase));
+            }
+        }
+
+        std::shared_ptr<FFT<Device::Vulkan, CF32>> module;
+        Run<Device::Vulkan, FFT, CF32>(module, {.forward = true}, {.buffer = buffer});
+
+        std::shared_ptr<FFT<Device::CPU, CF32>> reference;
+        Run<Device::CPU, FFT, CF32>(reference, {.forward = true}, {.buffer = host});
+
+        Tensor<Device::CPU, CF32> output(module->getOutputBuffer());
+        const auto& expected = reference->getOutputBuffer();
+
+        const F32 tolerance = 1e-4f * size;
+        for (U64 i = 0; i < output.size(); i++) {
+            assert(std::abs(output[i] - expected[i]) <= tolerance);
+        }
+
+        // A forward transform of a positive frequency peaks at its positive bin.
+
+        for (U64 b = 0; b < 2; b++) {
+            U64 peak = 0;
+            for (U64 i = 0; i < size; i++) {
+                if (std::abs(output[b * size + i]) > std::abs(output[b * size + peak])) {
+                    peak = i;
+                }
+            }
+            assert(peak == static_cast<U64>(std::round(bins[b])));
+        }
+    }
+
+    // Staged upload (CPU -> Vulkan)
+
+    {
+        Tensor<Device::CPU, F32> host({size});
+        Tensor<Device::Vulkan, F32> buffer(host);
+
+        assert(buffer.staged_devices().contains(Device::Vulkan));
+
+        auto module = std::make_shared<Multiply<Device::Vulkan, F32>>();
+        module->init_benchmark_mode({}, {.factorA = buffer, .factorB = buffer});
+        const Result created = module->create();
+        assert(created == Result::SUCCESS);
+
+        auto graph = NewGraph(Device::Vulkan);
+        const Result set = graph->setModule(module);
+        assert(set == Result::SUCCESS);
+        const Result transferAdded = graph->addTransfer({
+            .device = Device::CPU,
+            .source = host.data(),
+            .target = buffer.data(),
+            .sizeBytes = host.size_bytes(),
+        });
+        assert(transferAdded == Result::SUCCESS);
+        const Result graphCreated = graph->create();
+        assert(graphCreated == Result::SUCCESS);
+
+        // More frames than staging slots without waiting in between.
+        for (U64 frame = 1; frame <= 3; frame++) {
+            for (U64 i = 0; i < host.size(); i++) {
+                host[i] = frame + i * 0.01f;
+            }
+            const Result computed = graph->compute();
+            assert(computed == Result::SUCCESS);
+        }
+        const Result synchronized = graph->synchronize();
+        assert(synchronized == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> output(module->getOutputProduct());
+        for (U64 i = 0; i < output.size(); i++) {
+            assert(Close(output[i], host[i] * host[i]));
+        }
+
+        const Result destroyed = graph->destroy();
+        assert(destroyed == Result::SUCCESS);
+    }
+
+    // Staged upload from rebound caller memory
+
+    {
+        std::vector<F32> first(size, 1.0f);
+        std::vector<F32> second(size, 2.0f);
+
+        Tensor<Device::CPU, F32> host(first.data(), {size});
+        Tensor<Device::Vulkan, F32> buffer(host);
+
+        auto module = std::make_shared<Multiply<Device::Vulkan, F32>>();
+        module->init_benchmark_mode({}, {.factorA = buffer, .factorB = buffer});
+        const Result created = module->create();
+        assert(created == Result::SUCCESS);
+
+        auto graph = NewGraph(Device::Vulkan);
+        const Result set = graph->setModule(module);
+        assert(set == Result::SUCCESS);
+        const Result transferAdded = graph->addTransfer({
+            .device = Device::CPU,
+            .source = host.data(),
+            .target = buffer.data(),
+            .sizeBytes = host.size_bytes(),
+        });
+        assert(transferAdded == Result::SUCCESS);
+        const Result graphCreated = graph->create();
+        assert(graphCreated == Result::SUCCESS);
+
+        // The recorded upload follows the memory after a rebind.
+        const Result rebound = host.rebind(second.data());
+        assert(rebound == Result::SUCCESS);
+        const Result transfersRebound = graph->rebindTransfers(first.data(), second.data());
+        assert(transfersRebound == Result::SUCCESS);
+
+        const Result computed = graph->compute();
+        assert(computed == Result::SUCCESS);
+        const Result synchronized = graph->synchronize();
+        assert(synchronized == Result::SUCCESS);
+
+        Tensor<Device::CPU, F32> output(module->getOutputProduct());
+        for (U64 i = 0; i < output.size(); i++) {
+            assert(Close(output[i], 4.0f));
+        }
+
+        const Result destroyed = graph->destroy();
+        assert(destroyed == Result::SUCCESS);
+    }
+
+    // Staged download (Vulkan -> CPU) without uploads
+
+    {
+        Tensor<Device::Vulkan, F32> buffer({size});
+        Tensor<Device::CPU, F32> input(buffer);
+
+        for (U64 i = 0; i < input.size(); i++) {
+            input[i] = -100.0f + i * 0.1f;
+        }
+
+        std::vector<F32> host(size, 0.0f);
+
+        auto module = std::make_shared<Scale<Device::Vulkan, F32>>();
+        module->init_benchmark_mode({}, {.buffer = buffer});
+        const Result created = module->create();
+        assert(created == Result::SUCCESS);
+
+        auto graph = NewGraph(Device::Vulkan);
+        const Result set = graph->setModule(module);
+        assert(set == Result::SUCCESS);
+        const Result transferAdded = graph->addTransfer({
+            .device = Device::Vulkan,
+            .source = module->getOutputBuffer().data(),
+            .target = host.data(),
+            .sizeBytes = module->getOutputBuffer().size_bytes(),
+        });
+        assert(transferAdded == Result::SUCCESS);
+        const Result graphCreated = graph->create();
+        assert(graphCreated == Result::SUCCESS);
+
+        const auto expected = [&](const U64& frame, const U64& i) {
+            const F32 min = -100.0f * frame;
+            return (input[i] - min) / (0.0f - min);
+        };
+
+        // Each frame scales with a different range. A slot is completed when
+        // it's reused, so the host holds the frame from two computes ago.
+        const U64 frames = 6;
+        for (U64 frame = 1; frame <= frames; frame++) {
+            module->range({-100.0f * frame, 0.0f});
+            const Result computed = graph->compute();
+            assert(computed == Result::SUCCESS);
+
+            if (frame < 3) {
+                continue;
+            }
+            for (U64 i = 0; i < host.size(); i++) {
+                assert(Close(host[i], expected(frame - 2, i)));
+            }
+        }
+        const Result synchronized = graph->synchronize();
+        assert(synchronized == Result::SUCCESS);
+
+        for (U64 i = 0; i < host.size(); i++) {
+            assert(Close(host[i], expected(frames, i)));
+        }
+
+        const Result destroyed = graph->destroy();
+        assert(destroyed == Result::SUCCESS);
+    }
+
+    JST_CHECK_THROW(Backend::DestroyAll());
+
+    return 0;
+}